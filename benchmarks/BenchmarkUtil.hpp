@@ -0,0 +1,75 @@
+#ifndef FIGURES_BENCHMARKUTIL_HPP
+#define FIGURES_BENCHMARKUTIL_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+
+class BenchmarkUtil
+{
+  public:
+    template <typename Function> static double measureSeconds(Function &&function)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        function();
+        const auto end = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<double>(end - start).count();
+    }
+
+    static void report(const std::string &name, const std::size_t items, const std::string &unit,
+                       const double seconds)
+    {
+        std::cout << name << ": " << static_cast<double>(items) / seconds << ' ' << unit << "/s (" << seconds
+                  << " s for " << items << ' ' << unit << ")\n";
+    }
+
+    static std::string generateFigureText(const std::size_t count, const unsigned seed)
+    {
+        std::mt19937_64 rng(seed);
+        std::uniform_int_distribution typeDist(0, 2);
+        std::uniform_real_distribution valueDist(1.0, 1000.0);
+
+        std::ostringstream text;
+        text.precision(17);
+        for (std::size_t i = 0; i < count; i++)
+        {
+            const double value = valueDist(rng);
+            switch (typeDist(rng))
+            {
+            case 0:
+                text << "Triangle " << value << ' ' << value << ' ' << value << '\n';
+                break;
+            case 1:
+                text << "Circle " << value << '\n';
+                break;
+            default:
+                text << "Rectangle " << value << ' ' << value << '\n';
+            }
+        }
+        return text.str();
+    }
+
+    static void writeFigureFile(const std::string &filename, const std::size_t count)
+    {
+        constexpr std::size_t chunk = 1'000'000;
+
+        std::ofstream file(filename, std::ios::binary);
+        for (std::size_t written = 0; written < count; written += chunk)
+        {
+            file << generateFigureText(std::min(chunk, count - written), static_cast<unsigned>(written));
+        }
+    }
+
+    template <typename T> static void keep(const T &value)
+    {
+        asm volatile("" : : "g"(&value) : "memory");
+    }
+};
+
+#endif // FIGURES_BENCHMARKUTIL_HPP
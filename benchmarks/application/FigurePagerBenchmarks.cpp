@@ -0,0 +1,45 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <fstream>
+#include <limits>
+#include <memory>
+
+#include "../../src/application/figure_pager/FigurePager.hpp"
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t DISPLAYED_FIGURES = 10'000'000;
+
+TEST_CASE("Display throughput: operator<< with endl vs paged buffers", "[FigurePager]")
+{
+    FigureStore store;
+    RandomFigureFactory(15).createBatch(DISPLAYED_FIGURES, store);
+    std::ofstream output("/dev/null");
+
+    // How displayFigures wrote figures before it rendered pages
+    const double legacySeconds = BenchmarkUtil::measureSeconds([&] {
+        for (std::size_t i = 0; i < store.size(); i++)
+        {
+            output << i << ". " << *store.at(i) << std::endl;
+        }
+    });
+    BenchmarkUtil::report("operator<< + endl", store.size(), "figures", legacySeconds);
+
+    FigurePager pager(store, 0, std::numeric_limits<std::size_t>::max(), 1 << 16);
+    const double seconds = BenchmarkUtil::measureSeconds([&] {
+        while (pager.hasNext())
+        {
+            const std::string_view page = pager.next();
+            output.write(page.data(), static_cast<std::streamsize>(page.size()));
+        }
+    });
+    BenchmarkUtil::report("FigurePager pages", pager.getRendered(), "figures", seconds);
+
+    REQUIRE(pager.getRendered() == store.size());
+
+    const double pageSeconds = BenchmarkUtil::measureSeconds([&] {
+        FigurePager page(store, 5'000'000, 1000);
+        BenchmarkUtil::keep(page.next());
+    });
+    BenchmarkUtil::report("FigurePager single page", 1000, "figures", pageSeconds);
+}
@@ -0,0 +1,81 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <string>
+
+#include "../../src/factory/binary_figure_factory/BinaryFigureFactory.hpp"
+#include "../../src/factory/mmap_figure_factory/MmapFigureFactory.hpp"
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t SAVED_FIGURE_COUNT = 100'000'000;
+
+double columnSum(const FigureStore &store)
+{
+    double sum = 0;
+    for (const std::span<const double> column :
+         {store.getTriangleA(), store.getTriangleB(), store.getTriangleC(), store.getCircleRadius(),
+          store.getRectangleWidth(), store.getRectangleHeight()})
+    {
+        sum = std::accumulate(column.begin(), column.end(), sum);
+    }
+    return sum;
+}
+
+TEST_CASE("Text vs binary save and load", "[BinaryFigureFactory]")
+{
+    const std::string textFile = "benchmark_saved_figures.txt";
+    const std::string binaryFile = "benchmark_saved_figures.figb";
+
+    double savedSum = 0;
+    {
+        FigureStore store;
+        RandomFigureFactory().createBatch(SAVED_FIGURE_COUNT, store);
+        savedSum = columnSum(store);
+
+        const double textSeconds = BenchmarkUtil::measureSeconds([&] {
+            std::ofstream file(textFile);
+            for (std::size_t i = 0; i < store.size(); i++)
+            {
+                file << *store.at(i);
+            }
+        });
+        BenchmarkUtil::report("text save", store.size(), "figures", textSeconds);
+
+        const double binarySeconds = BenchmarkUtil::measureSeconds([&] {
+            std::ofstream file(binaryFile, std::ios::binary);
+            BinaryFigureFormat::write(file, store);
+        });
+        BenchmarkUtil::report("binary save", store.size(), "figures", binarySeconds);
+    }
+
+    std::cout << "text file: " << std::filesystem::file_size(textFile) << " bytes, binary file: "
+              << std::filesystem::file_size(binaryFile) << " bytes\n";
+
+    // Text keeps 6 significant digits, so some triangles no longer pass validation when read back and are skipped
+    {
+        FigureStore store;
+        MmapFigureFactory factory(textFile, true);
+        const double seconds =
+            BenchmarkUtil::measureSeconds([&] { factory.createBatch(SAVED_FIGURE_COUNT, store); });
+        REQUIRE(factory.getIngestReport()->getAccepted() + factory.getIngestReport()->getRejected() ==
+                SAVED_FIGURE_COUNT);
+        BenchmarkUtil::report("text load", SAVED_FIGURE_COUNT, "figures", seconds);
+        std::cout << "text load lost " << factory.getIngestReport()->getRejected() << " figures to rounding\n";
+    }
+
+    {
+        FigureStore store;
+        const double seconds = BenchmarkUtil::measureSeconds(
+            [&] { BinaryFigureFactory(binaryFile).createBatch(SAVED_FIGURE_COUNT, store); });
+        REQUIRE(store.size() == SAVED_FIGURE_COUNT);
+        REQUIRE(columnSum(store) == savedSum);
+        BenchmarkUtil::report("binary load", store.size(), "figures", seconds);
+    }
+
+    std::filesystem::remove(textFile);
+    std::filesystem::remove(binaryFile);
+}
@@ -0,0 +1,36 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../BenchmarkUtil.hpp"
+
+TEST_CASE("Per-figure create() vs createBatch()", "[FigureFactory]")
+{
+    for (const std::size_t count : {1'000ul, 1'000'000ul, 100'000'000ul})
+    {
+        {
+            RandomFigureFactory factory;
+            FigureStore store;
+
+            const double seconds = BenchmarkUtil::measureSeconds([&] {
+                for (std::size_t i = 0; i < count; i++)
+                {
+                    store.add(*factory.create());
+                }
+            });
+            REQUIRE(store.size() == count);
+            BenchmarkUtil::report("create() x " + std::to_string(count), count, "figures", seconds);
+        }
+
+        {
+            RandomFigureFactory factory;
+            FigureStore store;
+
+            const double seconds = BenchmarkUtil::measureSeconds([&] { factory.createBatch(count, store); });
+            REQUIRE(store.size() == count);
+            BenchmarkUtil::report("createBatch(" + std::to_string(count) + ")", count, "figures", seconds);
+        }
+    }
+}
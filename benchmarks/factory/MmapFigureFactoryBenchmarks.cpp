@@ -0,0 +1,69 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../../src/factory/mmap_figure_factory/MmapFigureFactory.hpp"
+#include "../../src/factory/stream_figure_factory/StreamFigureFactory.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t FIGURE_COUNT = 50'000'000;
+
+void evictFromPageCache(const std::string &filename)
+{
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    ::fdatasync(fd);
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    ::close(fd);
+}
+
+std::size_t drain(FigureFactory &factory)
+{
+    std::size_t count = 0;
+    while (factory.create() != nullptr)
+    {
+        count++;
+    }
+    return count;
+}
+
+TEST_CASE("File load time: ifstream vs mmap, cold and warm", "[MmapFigureFactory]")
+{
+    const std::string filename = "mmap_benchmark_input.txt";
+    BenchmarkUtil::writeFigureFile(filename, FIGURE_COUNT);
+    const std::size_t bytes = std::filesystem::file_size(filename);
+
+    for (const bool cold : {true, false})
+    {
+        const std::string cache = cold ? " (cold)" : " (warm)";
+
+        if (cold)
+        {
+            evictFromPageCache(filename);
+        }
+        std::size_t count = 0;
+        const double streamSeconds = BenchmarkUtil::measureSeconds([&] {
+            StreamFigureFactory factory(std::make_unique<std::ifstream>(filename));
+            count = drain(factory);
+        });
+        REQUIRE(count == FIGURE_COUNT);
+        BenchmarkUtil::report("ifstream" + cache, bytes, "bytes", streamSeconds);
+
+        if (cold)
+        {
+            evictFromPageCache(filename);
+        }
+        const double mmapSeconds = BenchmarkUtil::measureSeconds([&] {
+            MmapFigureFactory factory(filename);
+            count = drain(factory);
+        });
+        REQUIRE(count == FIGURE_COUNT);
+        BenchmarkUtil::report("mmap" + cache, bytes, "bytes", mmapSeconds);
+    }
+
+    std::filesystem::remove(filename);
+}
@@ -0,0 +1,39 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <filesystem>
+#include <memory>
+#include <thread>
+
+#include "../../src/factory/parallel_figure_factory/ParallelFigureFactory.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t FIGURE_COUNT = 20'000'000;
+
+TEST_CASE("Parallel file load scaling from 1 to N threads", "[ParallelFigureFactory]")
+{
+    const std::string filename = "parallel_benchmark_input.txt";
+    BenchmarkUtil::writeFigureFile(filename, FIGURE_COUNT);
+
+    const unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threads = 1;; threads = std::min(threads * 2, maxThreads))
+    {
+        std::size_t count = 0;
+        const double seconds = BenchmarkUtil::measureSeconds([&] {
+            ParallelFigureFactory factory(filename, threads);
+            while (factory.create() != nullptr)
+            {
+                count++;
+            }
+        });
+
+        REQUIRE(count == FIGURE_COUNT);
+        BenchmarkUtil::report(std::to_string(threads) + " thread(s)", count, "figures", seconds);
+
+        if (threads == maxThreads)
+        {
+            break;
+        }
+    }
+
+    std::filesystem::remove(filename);
+}
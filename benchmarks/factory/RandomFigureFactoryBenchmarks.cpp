@@ -0,0 +1,37 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t GENERATED_FIGURE_COUNT = 1'000'000'000;
+constexpr std::size_t GENERATION_CHUNK = 10'000'000;
+
+TEST_CASE("Seeded random generation scaling", "[RandomFigureFactory]")
+{
+    const unsigned maxThreads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (unsigned threads = 1; threads <= maxThreads; threads *= 2)
+    {
+        RandomFigureFactory factory(2024, threads);
+        FigureStore store;
+        double checksum = 0;
+
+        const double seconds = BenchmarkUtil::measureSeconds([&] {
+            for (std::size_t generated = 0; generated < GENERATED_FIGURE_COUNT; generated += GENERATION_CHUNK)
+            {
+                store.clear();
+                factory.createBatch(GENERATION_CHUNK, store);
+                checksum += store.getCircleRadius().back();
+            }
+        });
+        BenchmarkUtil::keep(checksum);
+
+        BenchmarkUtil::report("createBatch on " + std::to_string(threads) + " threads", GENERATED_FIGURE_COUNT,
+                              "figures", seconds);
+    }
+}
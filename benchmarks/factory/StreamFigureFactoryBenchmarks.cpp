@@ -0,0 +1,28 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <sstream>
+
+#include "../../src/factory/stream_figure_factory/StreamFigureFactory.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t FIGURE_COUNT = 5'000'000;
+
+TEST_CASE("StreamFigureFactory throughput", "[StreamFigureFactory]")
+{
+    StreamFigureFactory factory(
+        std::make_unique<std::istringstream>(BenchmarkUtil::generateFigureText(FIGURE_COUNT, 11)));
+
+    double perimeter = 0;
+    const double seconds = BenchmarkUtil::measureSeconds([&] {
+        while (const std::unique_ptr<Figure> figure = factory.create())
+        {
+            perimeter += figure->perimeter();
+        }
+    });
+    BenchmarkUtil::keep(perimeter);
+
+    REQUIRE(factory.getFiguresRead() == FIGURE_COUNT);
+    BenchmarkUtil::report("StreamFigureFactory", factory.getFiguresRead(), "figures", seconds);
+    BenchmarkUtil::report("StreamFigureFactory", factory.getBytesRead(), "bytes", seconds);
+}
@@ -0,0 +1,63 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t FORMATTED_FIGURE_COUNT = 5'000'000;
+
+// The stringstream toString() and operator<< pair every figure was printed with before formatTo
+std::string legacyToString(const Figure &figure)
+{
+    std::stringstream sstream;
+    switch (figure.getType())
+    {
+    case FigureUtil::TRIANGLE: {
+        const auto &triangle = static_cast<const Triangle &>(figure);
+        sstream << "Triangle " << triangle.getA() << " " << triangle.getB() << " " << triangle.getC();
+        break;
+    }
+    case FigureUtil::CIRCLE:
+        sstream << "Circle " << static_cast<const Circle &>(figure).getRadius();
+        break;
+    case FigureUtil::RECTANGLE: {
+        const auto &rectangle = static_cast<const Rectangle &>(figure);
+        sstream << "Rectangle " << rectangle.getWidth() << " " << rectangle.getHeight();
+        break;
+    }
+    }
+    return sstream.str();
+}
+
+TEST_CASE("Figure output throughput: stringstream vs formatTo", "[Figure]")
+{
+    FigureStore store;
+    RandomFigureFactory(5).createBatch(FORMATTED_FIGURE_COUNT, store);
+
+    std::ostringstream legacyOutput;
+    const double legacySeconds = BenchmarkUtil::measureSeconds([&] {
+        for (std::size_t i = 0; i < store.size(); i++)
+        {
+            legacyOutput << legacyToString(*store.at(i)) << '\n';
+        }
+    });
+    BenchmarkUtil::report("toString + operator<<", legacyOutput.view().size() / 1'000'000, "MB", legacySeconds);
+
+    std::string output;
+    const double seconds = BenchmarkUtil::measureSeconds([&] {
+        for (std::size_t i = 0; i < store.size(); i++)
+        {
+            store.formatTo(i, output);
+            output += '\n';
+        }
+    });
+    BenchmarkUtil::report("formatTo", output.size() / 1'000'000, "MB", seconds);
+    BenchmarkUtil::report("toString + operator<<", store.size(), "figures", legacySeconds);
+    BenchmarkUtil::report("formatTo", store.size(), "figures", seconds);
+
+    REQUIRE(output.size() > legacyOutput.view().size());
+}
@@ -0,0 +1,91 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../src/figure/figure_value/FigureValue.hpp"
+#include "../../src/util/figure_hash/FigureHash.hpp"
+#include "../../src/util/string_to_figure/StringToFigure.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t VALUE_FIGURE_COUNT = 10'000'000;
+
+TEST_CASE("Dispatch over mixed figures: virtual calls vs std::visit", "[FigureValue]")
+{
+    std::vector<std::unique_ptr<Figure>> figures;
+    std::vector<FigureValue> values;
+    figures.reserve(VALUE_FIGURE_COUNT);
+    values.reserve(VALUE_FIGURE_COUNT);
+    {
+        const std::string corpus = BenchmarkUtil::generateFigureText(VALUE_FIGURE_COUNT, 23);
+        for (std::size_t begin = 0, end; begin < corpus.size(); begin = end + 1)
+        {
+            end = corpus.find('\n', begin);
+            figures.push_back(StringToFigure::createFigure(std::string_view(corpus).substr(begin, end - begin)));
+            values.emplace_back(*figures.back());
+        }
+    }
+
+    double virtualPerimeter = 0;
+    const double virtualSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (const std::unique_ptr<Figure> &figure : figures)
+        {
+            virtualPerimeter += figure->perimeter();
+        }
+    });
+    BenchmarkUtil::report("virtual perimeter", figures.size(), "figures", virtualSeconds);
+
+    double valuePerimeter = 0;
+    const double valueSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (const FigureValue &value : values)
+        {
+            valuePerimeter += value.perimeter();
+        }
+    });
+    BenchmarkUtil::report("std::visit perimeter", values.size(), "figures", valueSeconds);
+
+    std::uint64_t virtualHash = 0;
+    const double virtualHashSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (const std::unique_ptr<Figure> &figure : figures)
+        {
+            virtualHash ^= FigureHash::hash(*figure);
+        }
+    });
+    BenchmarkUtil::report("virtual hash", figures.size(), "figures", virtualHashSeconds);
+
+    std::uint64_t valueHash = 0;
+    const double valueHashSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (const FigureValue &value : values)
+        {
+            valueHash ^= value.hash();
+        }
+    });
+    BenchmarkUtil::report("std::visit hash", values.size(), "figures", valueHashSeconds);
+
+    std::string virtualText;
+    const double virtualFormatSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (const std::unique_ptr<Figure> &figure : figures)
+        {
+            virtualText.clear();
+            figure->formatTo(virtualText);
+        }
+    });
+    BenchmarkUtil::report("virtual format", figures.size(), "figures", virtualFormatSeconds);
+
+    std::string valueText;
+    const double valueFormatSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (const FigureValue &value : values)
+        {
+            valueText.clear();
+            value.formatTo(valueText);
+        }
+    });
+    BenchmarkUtil::report("std::visit format", values.size(), "figures", valueFormatSeconds);
+
+    std::cout << "sizeof(FigureValue): " << sizeof(FigureValue) << " bytes\n";
+    REQUIRE(valuePerimeter == virtualPerimeter);
+    REQUIRE(valueHash == virtualHash);
+    REQUIRE(valueText == virtualText);
+}
@@ -0,0 +1,58 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <malloc.h>
+
+#include <memory>
+#include <vector>
+
+#include "../../src/figure/rectangle/Rectangle.hpp"
+#include "../../src/figure/shared_figure/SharedFigure.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t REPLICA_COUNT = 1'000'000;
+
+std::size_t heapInUse()
+{
+    const struct mallinfo2 info = mallinfo2();
+    return info.uordblks + info.hblkhd;
+}
+
+template <typename Replicate> void benchmarkReplicas(const std::string &name, Replicate &&replicate)
+{
+    const std::size_t before = heapInUse();
+    std::size_t replicas = 0;
+    std::size_t bytes = 0;
+
+    const double seconds = BenchmarkUtil::measureSeconds([&] {
+        auto copies = replicate();
+        bytes = heapInUse() - before;
+        replicas = copies.size();
+        BenchmarkUtil::keep(copies);
+    });
+
+    BenchmarkUtil::report(name, replicas, "replicas", seconds);
+    std::cout << name << ": " << bytes << " heap bytes\n";
+    REQUIRE(replicas == REPLICA_COUNT);
+}
+
+TEST_CASE("Replicating one figure: Clonable deep copies vs shared handles", "[SharedFigure]")
+{
+    const Rectangle rectangle(2, 3);
+    const SharedFigure shared = SharedFigure::make<Rectangle>(2, 3);
+    const AtomicSharedFigure atomicShared = AtomicSharedFigure::make<Rectangle>(2, 3);
+
+    benchmarkReplicas("clone() into unique_ptr", [&] {
+        std::vector<std::unique_ptr<Figure>> copies;
+        copies.reserve(REPLICA_COUNT);
+        for (std::size_t i = 0; i < REPLICA_COUNT; i++)
+        {
+            copies.emplace_back(rectangle.clone());
+        }
+        return copies;
+    });
+
+    benchmarkReplicas("SharedFigure copies", [&] { return std::vector<SharedFigure>(REPLICA_COUNT, shared); });
+
+    benchmarkReplicas("AtomicSharedFigure copies",
+                      [&] { return std::vector<AtomicSharedFigure>(REPLICA_COUNT, atomicShared); });
+}
@@ -0,0 +1,39 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <iostream>
+#include <memory>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/pipeline/aggregate_stage/AggregateStage.hpp"
+#include "../../src/pipeline/figure_pipeline/FigurePipeline.hpp"
+#include "../../src/pipeline/filter_stage/FilterStage.hpp"
+#include "../../src/util/memory_usage/MemoryUsage.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::array<std::size_t, 4> STREAM_SIZES = {1'000'000, 10'000'000, 100'000'000, 1'000'000'000};
+
+// Peak RSS only ever grows, so flat readings across sizes mean no run needed more memory than the first
+TEST_CASE("Pipeline memory stays flat as the stream grows", "[FigurePipeline]")
+{
+    for (const std::size_t count : STREAM_SIZES)
+    {
+        RandomFigureFactory source(count);
+        FigurePipeline pipeline;
+
+        auto filter = std::make_unique<FilterStage>();
+        filter->setPerimeterRange(100, 2000);
+        pipeline.addStage(std::move(filter));
+        const auto &aggregate =
+            static_cast<const AggregateStage &>(pipeline.addStage(std::make_unique<AggregateStage>()));
+
+        std::size_t streamed = 0;
+        const double seconds = BenchmarkUtil::measureSeconds([&] { streamed = pipeline.run(source, count); });
+        BenchmarkUtil::keep(aggregate.getAggregates());
+
+        REQUIRE(streamed == count);
+        BenchmarkUtil::report("FigurePipeline", streamed, "figures", seconds);
+        std::cout << "  peak RSS after " << count << " figures: " << MemoryUsage::peakResidentBytes() / 1024
+                  << " KiB\n";
+    }
+}
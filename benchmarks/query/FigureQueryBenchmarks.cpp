@@ -0,0 +1,50 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/query/figure_query/FigureQuery.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t QUERIED_FIGURES = 100'000'000;
+
+TEST_CASE("Query throughput over 100M figures", "[FigureQuery]")
+{
+    FigureStore store;
+    RandomFigureFactory(31).createBatch(QUERIED_FIGURES, store);
+
+    const unsigned threads = std::max(4u, std::thread::hardware_concurrency());
+
+    for (const char *text : {"triangle perimeter>1e308 sort=-perimeter limit=100", "sort=perimeter limit=1000",
+                             "circle radius<1e305", "rectangle width>1.7e308 sort=-height", "limit=100"})
+    {
+        const FigureQuery query = FigureQuery::parse(text);
+
+        std::size_t found = 0;
+        const double seconds = BenchmarkUtil::measureSeconds([&] { found = query.execute(store, 1).size(); });
+        BenchmarkUtil::report(std::string(text) + " (1 thread, " + std::to_string(found) + " found)", store.size(),
+                              "figures", seconds);
+
+        const double parallelSeconds = BenchmarkUtil::measureSeconds([&] { query.execute(store, threads); });
+        BenchmarkUtil::report(std::string(text) + " (" + std::to_string(threads) + " threads)", store.size(),
+                              "figures", parallelSeconds);
+    }
+
+    // The unfused alternative: copy the matching figures out, sort them all, then take the first 100
+    const double naiveSeconds = BenchmarkUtil::measureSeconds([&] {
+        std::vector<std::pair<double, std::size_t>> matches;
+        for (std::size_t i = 0; i < store.slotCount(); i++)
+        {
+            if (store.typeAt(i) == FigureUtil::TRIANGLE && store.perimeterAt(i) > 1e308)
+            {
+                matches.emplace_back(-store.perimeterAt(i), i);
+            }
+        }
+        std::ranges::sort(matches);
+        matches.resize(std::min<std::size_t>(matches.size(), 100));
+        BenchmarkUtil::keep(matches);
+    });
+    BenchmarkUtil::report("filter + full sort + truncate", store.size(), "figures", naiveSeconds);
+}
@@ -0,0 +1,64 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <random>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t AGGREGATE_STORE_SIZE = 10'000'000;
+constexpr std::size_t AGGREGATE_UPDATE_COUNT = 1'000'000;
+
+TEST_CASE("Statistics: virtual rescan vs live aggregates", "[FigureAggregates]")
+{
+    FigureStore store;
+    const double loadSeconds =
+        BenchmarkUtil::measureSeconds([&] { RandomFigureFactory(37).createBatch(AGGREGATE_STORE_SIZE, store); });
+    BenchmarkUtil::report("Load with live aggregates", store.size(), "figures", loadSeconds);
+
+    // The per-figure virtual perimeter() scan the statistics needed before the aggregates were kept
+    double rescanSum = 0;
+    const double rescanSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (std::size_t i = 0; i < store.slotCount(); i++)
+        {
+            const std::unique_ptr<Figure> figure = store.at(i);
+            rescanSum += figure->perimeter();
+        }
+    });
+    BenchmarkUtil::report("Virtual rescan", store.size(), "figures", rescanSeconds);
+    BenchmarkUtil::keep(rescanSum);
+
+    double sum = 0;
+    const double liveSeconds = BenchmarkUtil::measureSeconds([&] { sum = store.getAggregates().perimeterSum(); });
+    BenchmarkUtil::report("Live aggregates", 1, "queries", liveSeconds);
+    BenchmarkUtil::keep(sum);
+
+    std::mt19937_64 rng(41);
+    const double updateSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (std::size_t i = 0; i < AGGREGATE_UPDATE_COUNT; i++)
+        {
+            const std::size_t number = std::uniform_int_distribution<std::size_t>(0, store.slotCount() - 1)(rng);
+            if (!store.contains(number))
+            {
+                continue;
+            }
+
+            if (i % 2 == 0)
+            {
+                store.clone(number);
+            }
+            else
+            {
+                store.remove(number);
+            }
+
+            sum += store.getAggregates().meanPerimeter();
+        }
+    });
+    BenchmarkUtil::report("Clone/delete with a stats query after each", AGGREGATE_UPDATE_COUNT, "updates",
+                          updateSeconds);
+    BenchmarkUtil::keep(sum);
+
+    REQUIRE(store.getAggregates().count() == store.size());
+}
@@ -0,0 +1,93 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <unistd.h>
+
+#include <fstream>
+#include <memory>
+#include <vector>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/store/figure_arena/FigureArena.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t ARENA_FIGURE_COUNT = 10'000'000;
+
+std::size_t residentBytes()
+{
+    std::ifstream statm("/proc/self/statm");
+    std::size_t pages = 0;
+    statm >> pages >> pages;
+    return pages * static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+}
+
+void reportResident(const std::string &name, const std::size_t baseline)
+{
+    std::cout << name << ": " << (residentBytes() - std::min(baseline, residentBytes())) / (1 << 20)
+              << " MiB resident above baseline\n";
+}
+
+TEST_CASE("Loading and tearing down figures: malloc vs arena", "[FigureArena]")
+{
+    // The arena runs first: its buffers go back to the system on release, while the heap glibc keeps after the
+    // malloc run would hide the arena's own footprint
+    std::size_t baseline = residentBytes();
+    double perimeter = 0;
+
+    {
+        RandomFigureFactory factory(5);
+        FigureArena arena;
+        std::vector<Figure *> figures;
+        figures.reserve(ARENA_FIGURE_COUNT);
+
+        const double loadSeconds = BenchmarkUtil::measureSeconds([&] {
+            for (std::size_t i = 0; i < ARENA_FIGURE_COUNT; i++)
+            {
+                figures.push_back(factory.createIn(arena));
+            }
+        });
+        BenchmarkUtil::report("arena load", figures.size(), "figures", loadSeconds);
+        reportResident("arena after load", baseline);
+        perimeter += figures.back()->perimeter();
+
+        const double teardownSeconds = BenchmarkUtil::measureSeconds([&] {
+            arena.release();
+            figures.clear();
+            figures.shrink_to_fit();
+        });
+        BenchmarkUtil::report("arena teardown", ARENA_FIGURE_COUNT, "figures", teardownSeconds);
+    }
+    reportResident("arena after teardown", baseline);
+
+    baseline = residentBytes();
+    {
+        RandomFigureFactory factory(5);
+        std::vector<std::unique_ptr<Figure>> figures;
+        figures.reserve(ARENA_FIGURE_COUNT);
+
+        const double loadSeconds = BenchmarkUtil::measureSeconds([&] {
+            for (std::size_t i = 0; i < ARENA_FIGURE_COUNT; i++)
+            {
+                figures.push_back(factory.create());
+            }
+        });
+        BenchmarkUtil::report("malloc load", figures.size(), "figures", loadSeconds);
+        reportResident("malloc after load", baseline);
+        perimeter -= figures.back()->perimeter();
+
+        // Free every other figure, as a long session of deletes would, before the whole collection goes
+        for (std::size_t i = 0; i < figures.size(); i += 2)
+        {
+            figures[i].reset();
+        }
+        reportResident("malloc after freeing half", baseline);
+
+        const double teardownSeconds = BenchmarkUtil::measureSeconds([&] {
+            figures.clear();
+            figures.shrink_to_fit();
+        });
+        BenchmarkUtil::report("malloc teardown", ARENA_FIGURE_COUNT, "figures", teardownSeconds);
+    }
+    reportResident("malloc after teardown", baseline);
+
+    REQUIRE(perimeter == 0);
+}
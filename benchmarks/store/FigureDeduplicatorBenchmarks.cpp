@@ -0,0 +1,52 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <random>
+#include <thread>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/store/figure_deduplicator/FigureDeduplicator.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../../src/util/memory_usage/MemoryUsage.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t DEDUP_SIZE = 100'000'000;
+constexpr std::size_t DEDUP_DISTINCT = DEDUP_SIZE / 10;
+
+TEST_CASE("Deduplicating 100M figures with 90% duplicates", "[FigureDeduplicator]")
+{
+    FigureStore store;
+    {
+        FigureStore distinct;
+        RandomFigureFactory(53).createBatch(DEDUP_DISTINCT, distinct);
+
+        std::mt19937_64 rng(59);
+        std::uniform_int_distribution<std::size_t> pick(0, DEDUP_DISTINCT - 1);
+
+        store.reserve(DEDUP_SIZE);
+        store.append(distinct);
+        for (std::size_t i = DEDUP_DISTINCT; i < DEDUP_SIZE; i++)
+        {
+            store.append(distinct, pick(rng), 1);
+        }
+    }
+    std::cout << "Peak resident memory after loading: " << MemoryUsage::peakResidentBytes() << " bytes\n";
+
+    const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    FigureDeduplicator::Result counted;
+    const double countSeconds =
+        BenchmarkUtil::measureSeconds([&] { counted = FigureDeduplicator::count(store, threads); });
+    BenchmarkUtil::report("Count duplicates", counted.figures, "figures", countSeconds);
+    std::cout << "Distinct: " << counted.distinct << ", duplicates: " << counted.duplicates
+              << ", hash table: " << counted.tableBytes << " bytes\n";
+
+    FigureDeduplicator::Result removed;
+    const double removeSeconds =
+        BenchmarkUtil::measureSeconds([&] { removed = FigureDeduplicator::removeDuplicates(store, threads); });
+    BenchmarkUtil::report("Remove duplicates", removed.figures, "figures", removeSeconds);
+    std::cout << "Peak resident memory after deduplicating: " << MemoryUsage::peakResidentBytes() << " bytes\n";
+
+    REQUIRE(counted.distinct == removed.distinct);
+    REQUIRE(store.size() == counted.distinct);
+    REQUIRE(counted.distinct <= DEDUP_DISTINCT);
+    REQUIRE(counted.duplicates == DEDUP_SIZE - counted.distinct);
+}
@@ -0,0 +1,80 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/store/figure_sorter/FigureSorter.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t SORT_SIZE = 10'000'000;
+
+TEST_CASE("Sorting by perimeter: virtual comparator vs key sorts", "[FigureSorter]")
+{
+    FigureStore store;
+    RandomFigureFactory(43).createBatch(SORT_SIZE, store);
+
+    // What sorting the std::vector<std::unique_ptr<Figure>> collection by hand looks like
+    std::vector<std::unique_ptr<Figure>> legacy;
+    legacy.reserve(store.size());
+    for (std::size_t i = 0; i < store.size(); i++)
+    {
+        legacy.push_back(store.at(i));
+    }
+
+    const double legacySeconds = BenchmarkUtil::measureSeconds([&] {
+        std::ranges::stable_sort(legacy, [](const std::unique_ptr<Figure> &left, const std::unique_ptr<Figure> &right) {
+            return left->perimeter() < right->perimeter();
+        });
+    });
+    BenchmarkUtil::report("std::stable_sort with virtual perimeter()", legacy.size(), "figures", legacySeconds);
+
+    std::vector<std::uint32_t> expected;
+    for (const FigureSorter::Algorithm algorithm : {FigureSorter::RADIX, FigureSorter::MERGE})
+    {
+        const std::string name = algorithm == FigureSorter::RADIX ? "Radix sort" : "Merge sort";
+
+        for (const unsigned threads : {1u, 2u, 4u, 8u, 16u, 32u, 64u})
+        {
+            std::vector<std::uint32_t> order;
+            const double seconds = BenchmarkUtil::measureSeconds(
+                [&] { order = FigureSorter::order(store, FigureSorter::PERIMETER, false, threads, algorithm); });
+            BenchmarkUtil::report(name + ", " + std::to_string(threads) + " threads", order.size(), "figures",
+                                  seconds);
+
+            if (expected.empty())
+            {
+                expected = std::move(order);
+            }
+            else
+            {
+                REQUIRE(order == expected);
+            }
+        }
+    }
+
+    for (std::size_t i = 0; i < legacy.size(); i += legacy.size() / 10)
+    {
+        REQUIRE(legacy[i]->perimeter() == store.perimeterAt(expected[i]));
+    }
+}
+
+TEST_CASE("Sorting and renumbering the store by each key", "[FigureSorter]")
+{
+    FigureStore store;
+    RandomFigureFactory(47).createBatch(SORT_SIZE, store);
+    const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for (const FigureSorter::Key key : {FigureSorter::TYPE, FigureSorter::PERIMETER, FigureSorter::RADIUS})
+    {
+        const double seconds = BenchmarkUtil::measureSeconds([&] { FigureSorter::sort(store, key, true, threads); });
+        BenchmarkUtil::report("Sort and renumber by key " + std::to_string(key), store.size(), "figures", seconds);
+    }
+
+    REQUIRE(store.size() == SORT_SIZE);
+}
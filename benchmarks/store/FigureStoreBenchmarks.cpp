@@ -0,0 +1,115 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t STORE_SIZE = 10'000'000;
+constexpr std::size_t DELETE_COUNT = 200;
+
+// The std::vector<std::unique_ptr<Figure>> with erase that deleteFigure used before the slot-numbered store
+std::vector<std::unique_ptr<Figure>> makeLegacyFigures(const FigureStore &store)
+{
+    std::vector<std::unique_ptr<Figure>> figures;
+    figures.reserve(store.size());
+    for (std::size_t i = 0; i < store.size(); i++)
+    {
+        figures.push_back(store.at(i));
+    }
+    return figures;
+}
+
+std::vector<std::size_t> randomPositions(const std::size_t size, const std::size_t count)
+{
+    std::mt19937_64 rng(3);
+    std::vector<std::size_t> positions;
+    for (std::size_t i = 0; i < count; i++)
+    {
+        positions.push_back(std::uniform_int_distribution<std::size_t>(0, size - 1 - i)(rng));
+    }
+    return positions;
+}
+
+TEST_CASE("Deleting from the front: vector erase vs slot store", "[FigureStore]")
+{
+    FigureStore store;
+    RandomFigureFactory(5).createBatch(STORE_SIZE, store);
+    std::vector<std::unique_ptr<Figure>> legacy = makeLegacyFigures(store);
+
+    const double legacySeconds = BenchmarkUtil::measureSeconds([&] {
+        for (std::size_t i = 0; i < DELETE_COUNT; i++)
+        {
+            legacy.erase(legacy.begin());
+        }
+    });
+    BenchmarkUtil::report("vector erase (front)", DELETE_COUNT, "deletes", legacySeconds);
+
+    const double seconds = BenchmarkUtil::measureSeconds([&] {
+        for (std::size_t i = 0; i < DELETE_COUNT; i++)
+        {
+            store.remove(i);
+        }
+    });
+    BenchmarkUtil::report("FigureStore::remove (front)", DELETE_COUNT, "deletes", seconds);
+
+    REQUIRE(store.size() == legacy.size());
+    REQUIRE(store.at(DELETE_COUNT)->toString() == legacy.front()->toString());
+
+    const double compactSeconds = BenchmarkUtil::measureSeconds([&] { store.compact(); });
+    BenchmarkUtil::report("FigureStore::compact", store.size(), "figures", compactSeconds);
+    REQUIRE(store.at(0)->toString() == legacy.front()->toString());
+}
+
+TEST_CASE("Deleting at random and cloning: vector erase vs slot store", "[FigureStore]")
+{
+    FigureStore store;
+    RandomFigureFactory(6).createBatch(STORE_SIZE, store);
+    std::vector<std::unique_ptr<Figure>> legacy = makeLegacyFigures(store);
+    const std::vector<std::size_t> positions = randomPositions(STORE_SIZE, DELETE_COUNT);
+
+    const double legacySeconds = BenchmarkUtil::measureSeconds([&] {
+        for (const std::size_t position : positions)
+        {
+            legacy.push_back(std::unique_ptr<Figure>(legacy[position]->clone()));
+            legacy.erase(legacy.begin() + static_cast<std::ptrdiff_t>(position));
+        }
+    });
+    BenchmarkUtil::report("vector clone + erase (random)", DELETE_COUNT, "operations", legacySeconds);
+
+    // The store keeps numbers stable, so the n-th surviving figure is looked up by walking the slots once up front
+    std::vector<std::size_t> slots;
+    {
+        std::vector<std::size_t> live(STORE_SIZE);
+        for (std::size_t i = 0; i < STORE_SIZE; i++)
+        {
+            live[i] = i;
+        }
+        for (const std::size_t position : positions)
+        {
+            slots.push_back(live[position]);
+            live.push_back(STORE_SIZE + slots.size() - 1);
+            live.erase(live.begin() + static_cast<std::ptrdiff_t>(position));
+        }
+    }
+
+    const double seconds = BenchmarkUtil::measureSeconds([&] {
+        for (const std::size_t slot : slots)
+        {
+            store.clone(slot);
+            store.remove(slot);
+        }
+    });
+    BenchmarkUtil::report("FigureStore clone + remove (random)", DELETE_COUNT, "operations", seconds);
+
+    store.compact();
+    REQUIRE(store.size() == legacy.size());
+    for (std::size_t i = 0; i < legacy.size(); i += legacy.size() / 97)
+    {
+        REQUIRE(store.at(i)->toString() == legacy[i]->toString());
+    }
+    REQUIRE(store.at(legacy.size() - 1)->toString() == legacy.back()->toString());
+}
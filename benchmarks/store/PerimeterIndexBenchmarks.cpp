@@ -0,0 +1,146 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../../src/store/perimeter_index/PerimeterIndex.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t INDEX_SIZE = 10'000'000;
+constexpr std::size_t INDEX_QUERY_COUNT = 1'000'000;
+constexpr std::size_t SCAN_QUERY_COUNT = 10;
+constexpr std::size_t UPDATE_COUNT = 1'000'000;
+
+TEST_CASE("Perimeter index build: incremental inserts vs sort-based bulk load", "[PerimeterIndex]")
+{
+    FigureStore store;
+    RandomFigureFactory(17).createBatch(INDEX_SIZE, store);
+
+    std::vector<std::pair<double, std::size_t>> sorted;
+    const double sortSeconds = BenchmarkUtil::measureSeconds([&] {
+        sorted.reserve(store.size());
+        for (std::size_t i = 0; i < store.slotCount(); i++)
+        {
+            sorted.emplace_back(store.perimeterAt(i), i);
+        }
+        std::ranges::sort(sorted);
+    });
+    BenchmarkUtil::report("std::sort of (perimeter, number)", sorted.size(), "figures", sortSeconds);
+
+    PerimeterIndex bulk;
+    const double bulkSeconds = BenchmarkUtil::measureSeconds([&] { bulk.build(store); });
+    BenchmarkUtil::report("PerimeterIndex bulk load", bulk.size(), "figures", bulkSeconds);
+
+    PerimeterIndex incremental;
+    const double incrementalSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (std::size_t i = 0; i < store.slotCount(); i++)
+        {
+            incremental.insert(store.perimeterAt(i), i);
+        }
+    });
+    BenchmarkUtil::report("PerimeterIndex incremental inserts", incremental.size(), "figures", incrementalSeconds);
+
+    for (const std::size_t k : {std::size_t{0}, INDEX_SIZE / 2, INDEX_SIZE - 1})
+    {
+        REQUIRE(bulk.kth(k).number == sorted[k].second);
+        REQUIRE(incremental.kth(k).number == sorted[k].second);
+    }
+}
+
+TEST_CASE("Perimeter range count and rank: index vs scan", "[PerimeterIndex]")
+{
+    FigureStore store;
+    RandomFigureFactory(19).createBatch(INDEX_SIZE, store);
+
+    PerimeterIndex index;
+    index.build(store);
+
+    std::mt19937_64 rng(23);
+    std::uniform_int_distribution<std::size_t> rankDist(0, INDEX_SIZE - 1);
+    std::vector<std::pair<double, double>> ranges;
+    for (std::size_t i = 0; i < INDEX_QUERY_COUNT; i++)
+    {
+        const double a = index.kth(rankDist(rng)).perimeter;
+        const double b = index.kth(rankDist(rng)).perimeter;
+        ranges.emplace_back(std::min(a, b), std::max(a, b));
+    }
+
+    std::size_t scanned = 0;
+    const double scanSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (std::size_t q = 0; q < SCAN_QUERY_COUNT; q++)
+        {
+            for (std::size_t i = 0; i < store.slotCount(); i++)
+            {
+                const double perimeter = store.perimeterAt(i);
+                scanned += perimeter >= ranges[q].first && perimeter <= ranges[q].second;
+            }
+        }
+    });
+    BenchmarkUtil::report("Range count by scan", SCAN_QUERY_COUNT, "queries", scanSeconds);
+
+    std::size_t counted = 0;
+    const double countSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (const auto &[minPerimeter, maxPerimeter] : ranges)
+        {
+            counted += index.countInRange(minPerimeter, maxPerimeter);
+        }
+    });
+    BenchmarkUtil::report("Range count by index", INDEX_QUERY_COUNT, "queries", countSeconds);
+
+    double perimeter = 0;
+    const double rankSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (std::size_t q = 0; q < INDEX_QUERY_COUNT; q++)
+        {
+            perimeter += index.kth(q * 7 % INDEX_SIZE).perimeter;
+        }
+    });
+    BenchmarkUtil::report("k-th smallest by index", INDEX_QUERY_COUNT, "queries", rankSeconds);
+    BenchmarkUtil::keep(perimeter);
+    BenchmarkUtil::keep(counted);
+
+    std::size_t expected = 0;
+    for (std::size_t q = 0; q < SCAN_QUERY_COUNT; q++)
+    {
+        expected += index.countInRange(ranges[q].first, ranges[q].second);
+    }
+    REQUIRE(scanned == expected);
+}
+
+TEST_CASE("Perimeter index maintenance under clone and delete", "[PerimeterIndex]")
+{
+    FigureStore store;
+    RandomFigureFactory(29).createBatch(INDEX_SIZE, store);
+
+    PerimeterIndex index;
+    index.build(store);
+
+    std::mt19937_64 rng(31);
+    const double seconds = BenchmarkUtil::measureSeconds([&] {
+        for (std::size_t i = 0; i < UPDATE_COUNT; i++)
+        {
+            const std::size_t number = std::uniform_int_distribution<std::size_t>(0, store.slotCount() - 1)(rng);
+            if (!store.contains(number))
+            {
+                continue;
+            }
+
+            if (i % 2 == 0)
+            {
+                const FigureStore::Handle copy = store.clone(number);
+                index.insert(store.perimeterAt(copy.slot), copy.slot);
+            }
+            else
+            {
+                index.erase(store.perimeterAt(number), number);
+                store.remove(number);
+            }
+        }
+    });
+    BenchmarkUtil::report("Clone/delete with index upkeep", UPDATE_COUNT, "updates", seconds);
+
+    REQUIRE(index.size() == store.size());
+}
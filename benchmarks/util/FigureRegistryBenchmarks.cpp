@@ -0,0 +1,146 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <cctype>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <vector>
+
+#include "../../src/util/figure_registry/FigureRegistry.hpp"
+#include "../../src/util/string_to_figure/StringToFigure.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t NAME_COUNT = 10'000'000;
+
+bool legacyEqualsIgnoreCase(const std::string_view str, const std::string_view lowercase)
+{
+    if (str.size() != lowercase.size())
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < str.size(); i++)
+    {
+        if (std::tolower(static_cast<unsigned char>(str[i])) != lowercase[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// The if-chain StringToFigure::parseFigureType used before the registry
+std::optional<FigureUtil::FigureType> legacyParseFigureType(const std::string_view name)
+{
+    if (legacyEqualsIgnoreCase(name, "triangle"))
+    {
+        return FigureUtil::TRIANGLE;
+    }
+
+    if (legacyEqualsIgnoreCase(name, "circle"))
+    {
+        return FigureUtil::CIRCLE;
+    }
+
+    if (legacyEqualsIgnoreCase(name, "rectangle"))
+    {
+        return FigureUtil::RECTANGLE;
+    }
+
+    return std::nullopt;
+}
+
+// The switch StringToFigure::createFigure used before the registry
+std::unique_ptr<Figure> legacyCreateFigure(const FigureUtil::FigureType type, const std::span<const double> params)
+{
+    if (params.size() != FigureUtil::getFigureParams(type))
+    {
+        throw std::invalid_argument("Wrong parameter count");
+    }
+
+    switch (type)
+    {
+    case FigureUtil::TRIANGLE:
+        return std::make_unique<Triangle>(params[0], params[1], params[2]);
+    case FigureUtil::CIRCLE:
+        return std::make_unique<Circle>(params[0]);
+    case FigureUtil::RECTANGLE:
+        return std::make_unique<Rectangle>(params[0], params[1]);
+    }
+
+    return nullptr;
+}
+
+std::vector<std::string_view> figureNames(const std::string &corpus)
+{
+    std::vector<std::string_view> names;
+    names.reserve(NAME_COUNT);
+    for (std::size_t begin = 0; begin < corpus.size(); begin = corpus.find('\n', begin) + 1)
+    {
+        names.emplace_back(corpus.data() + begin, corpus.find(' ', begin) - begin);
+    }
+    return names;
+}
+
+TEST_CASE("Figure name lookup: if-chain vs compile-time perfect hash", "[FigureRegistry]")
+{
+    const std::string corpus = BenchmarkUtil::generateFigureText(NAME_COUNT, 13);
+    const std::vector<std::string_view> names = figureNames(corpus);
+
+    unsigned legacySum = 0;
+    const double legacySeconds = BenchmarkUtil::measureSeconds([&] {
+        for (const std::string_view name : names)
+        {
+            legacySum += *legacyParseFigureType(name);
+        }
+    });
+    BenchmarkUtil::report("if-chain lookup", names.size(), "names", legacySeconds);
+
+    unsigned sum = 0;
+    const double seconds = BenchmarkUtil::measureSeconds([&] {
+        for (const std::string_view name : names)
+        {
+            sum += *FigureRegistry::find(name);
+        }
+    });
+    BenchmarkUtil::report("perfect hash lookup", names.size(), "names", seconds);
+
+    REQUIRE(sum == legacySum);
+}
+
+TEST_CASE("Figure construction from a type: switch vs registry dispatch", "[FigureRegistry]")
+{
+    const std::string corpus = BenchmarkUtil::generateFigureText(NAME_COUNT, 17);
+    std::vector<FigureUtil::FigureType> types;
+    types.reserve(NAME_COUNT);
+    for (const std::string_view name : figureNames(corpus))
+    {
+        types.push_back(*FigureRegistry::find(name));
+    }
+    constexpr std::array params{3.0, 4.0, 5.0};
+
+    double legacyPerimeter = 0;
+    const double legacySeconds = BenchmarkUtil::measureSeconds([&] {
+        for (const FigureUtil::FigureType type : types)
+        {
+            legacyPerimeter += legacyCreateFigure(type, std::span(params).first(FigureUtil::getFigureParams(type)))
+                                   ->perimeter();
+        }
+    });
+    BenchmarkUtil::report("switch construction", types.size(), "figures", legacySeconds);
+
+    double perimeter = 0;
+    const double seconds = BenchmarkUtil::measureSeconds([&] {
+        for (const FigureUtil::FigureType type : types)
+        {
+            perimeter += StringToFigure::createFigure(type, std::span(params).first(FigureUtil::getFigureParams(type)))
+                             ->perimeter();
+        }
+    });
+    BenchmarkUtil::report("registry construction", types.size(), "figures", seconds);
+
+    REQUIRE(perimeter == legacyPerimeter);
+}
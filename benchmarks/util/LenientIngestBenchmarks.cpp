@@ -0,0 +1,117 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../../src/util/figure_reader/FigureReader.hpp"
+#include "../../src/util/ingest_report/IngestReport.hpp"
+#include "../../src/util/string_to_figure/StringToFigure.hpp"
+#include "../../src/util/view_tokenizer/ViewTokenizer.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t DIRTY_LINE_COUNT = 5'000'000;
+constexpr std::size_t INVALID_EVERY = 10;
+
+// Every tenth line of the generated corpus is replaced with one of a few kinds of invalid figure
+std::string generateDirtyFigureText(const std::size_t count)
+{
+    constexpr std::array<const char *, 5> invalidLines = {"circle -5", "rectangle 10 abc", "triangle 1 2 10",
+                                                          "pentagon 1 2 3 4 5", "circle 1e400"};
+
+    const std::string clean = BenchmarkUtil::generateFigureText(count, 13);
+
+    std::string dirty;
+    dirty.reserve(clean.size());
+
+    std::size_t line = 0;
+    for (std::size_t begin = 0, end; begin < clean.size(); begin = end + 1, line++)
+    {
+        end = clean.find('\n', begin);
+        if (line % INVALID_EVERY == INVALID_EVERY - 1)
+        {
+            dirty += invalidLines[line / INVALID_EVERY % invalidLines.size()];
+        }
+        else
+        {
+            dirty.append(clean, begin, end - begin);
+        }
+        dirty += '\n';
+    }
+
+    return dirty;
+}
+
+TEST_CASE("Ingest of a 10% invalid corpus: exceptions vs std::expected", "[LenientIngest]")
+{
+    const std::string corpus = generateDirtyFigureText(DIRTY_LINE_COUNT);
+
+    std::vector<std::string_view> lines;
+    lines.reserve(DIRTY_LINE_COUNT);
+    for (std::size_t begin = 0, end; begin < corpus.size(); begin = end + 1)
+    {
+        end = corpus.find('\n', begin);
+        lines.emplace_back(corpus.data() + begin, end - begin);
+    }
+
+    std::size_t thrown = 0;
+    double throwingPerimeter = 0;
+    const double throwingSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (const std::string_view line : lines)
+        {
+            try
+            {
+                if (const std::unique_ptr<Figure> figure = StringToFigure::createFigure(line))
+                {
+                    throwingPerimeter += figure->perimeter();
+                }
+                else
+                {
+                    thrown++;
+                }
+            } catch (const std::invalid_argument &)
+            {
+                thrown++;
+            }
+        }
+    });
+    BenchmarkUtil::report("createFigure + catch", lines.size(), "lines", throwingSeconds);
+
+    std::size_t rejected = 0;
+    double perimeter = 0;
+    const double seconds = BenchmarkUtil::measureSeconds([&] {
+        for (const std::string_view line : lines)
+        {
+            const std::expected<std::unique_ptr<Figure>, ParseError::Code> figure =
+                StringToFigure::tryCreateFigure(line);
+            if (figure.has_value())
+            {
+                perimeter += (*figure)->perimeter();
+            }
+            else
+            {
+                rejected++;
+            }
+        }
+    });
+    BenchmarkUtil::report("tryCreateFigure", lines.size(), "lines", seconds);
+
+    REQUIRE(rejected == thrown);
+    REQUIRE(rejected == DIRTY_LINE_COUNT / INVALID_EVERY);
+    REQUIRE(perimeter == throwingPerimeter);
+
+    ViewTokenizer tokenizer(corpus);
+    IngestReport report;
+    FigureStore store;
+    const double lenientSeconds = BenchmarkUtil::measureSeconds([&] {
+        FigureReader::readLenient(tokenizer, DIRTY_LINE_COUNT, report,
+                                  [&store](const auto &figure) { store.add(figure); });
+    });
+    BenchmarkUtil::report("lenient FigureReader into FigureStore", lines.size(), "lines", lenientSeconds);
+
+    REQUIRE(report.getRejected() == rejected);
+    REQUIRE(store.size() == DIRTY_LINE_COUNT - rejected);
+}
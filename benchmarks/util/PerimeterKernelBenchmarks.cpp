@@ -0,0 +1,65 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+#include <vector>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../../src/util/perimeter_kernel/PerimeterKernel.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t FIGURE_COUNT = 3'000'000;
+constexpr int PASSES = 10;
+
+TEST_CASE("Perimeter throughput: virtual calls vs batch kernels", "[PerimeterKernel]")
+{
+    RandomFigureFactory factory;
+    std::vector<std::unique_ptr<Figure>> figures;
+    FigureStore store;
+
+    figures.reserve(FIGURE_COUNT);
+    store.reserve(FIGURE_COUNT);
+    for (std::size_t i = 0; i < FIGURE_COUNT; i++)
+    {
+        figures.push_back(factory.create());
+        store.add(*figures.back());
+    }
+
+    std::vector<double> out(FIGURE_COUNT);
+
+    const double virtualSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (int pass = 0; pass < PASSES; pass++)
+        {
+            for (std::size_t i = 0; i < figures.size(); i++)
+            {
+                out[i] = figures[i]->perimeter();
+            }
+            BenchmarkUtil::keep(out);
+        }
+    });
+    BenchmarkUtil::report("virtual perimeter()", FIGURE_COUNT * PASSES, "figures", virtualSeconds);
+
+    for (const PerimeterKernel::Isa isa : {PerimeterKernel::SCALAR, PerimeterKernel::SSE2, PerimeterKernel::AVX2})
+    {
+        if (!PerimeterKernel::isSupported(isa))
+        {
+            continue;
+        }
+
+        const double seconds = BenchmarkUtil::measureSeconds([&] {
+            for (int pass = 0; pass < PASSES; pass++)
+            {
+                std::span<double> rest(out);
+                rest = rest.subspan(PerimeterKernel::triangles(isa, store.getTriangleA(), store.getTriangleB(),
+                                                               store.getTriangleC(), rest)
+                                        .size());
+                rest = rest.subspan(PerimeterKernel::circles(isa, store.getCircleRadius(), rest).size());
+                PerimeterKernel::rectangles(isa, store.getRectangleWidth(), store.getRectangleHeight(), rest);
+                BenchmarkUtil::keep(out);
+            }
+        });
+
+        const char *names[] = {"scalar kernel", "SSE2 kernel", "AVX2 kernel"};
+        BenchmarkUtil::report(names[isa], FIGURE_COUNT * PASSES, "figures", seconds);
+    }
+}
@@ -0,0 +1,124 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../../src/util/figure_reader/FigureReader.hpp"
+#include "../../src/util/plugin_registry/PluginRegistry.hpp"
+#include "../../src/util/string_to_figure/StringToFigure.hpp"
+#include "../../src/util/view_tokenizer/ViewTokenizer.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t PLUGIN_RECORD_COUNT = 2'000'000;
+constexpr std::size_t PLUGIN_FIGURE_COUNT = 10'000'000;
+
+std::string generatePluginFigureText(const std::size_t count, const unsigned seed)
+{
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution typeDist(0, 2);
+    std::uniform_real_distribution valueDist(1.0, 1000.0);
+
+    std::ostringstream text;
+    text.precision(17);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        const double value = valueDist(rng);
+        switch (typeDist(rng))
+        {
+        case 0:
+            text << "Polygon 6 " << value << '\n';
+            break;
+        case 1:
+            text << "Ellipse " << value << ' ' << value / 2 << '\n';
+            break;
+        default:
+            text << "Trapezoid " << value + 4 << " 4 " << value + 4 << ' ' << value + 4 << '\n';
+        }
+    }
+    return text.str();
+}
+
+FigureStore readPluginBenchmarkText(const std::string_view text)
+{
+    FigureStore store;
+    store.reserve(PLUGIN_RECORD_COUNT);
+
+    ViewTokenizer tokenizer(text);
+    while (FigureReader::readWith(tokenizer, [&store](const auto &figure) { store.add(figure); }))
+    {
+    }
+    return store;
+}
+
+TEST_CASE("Text parsing with plugins loaded", "[PluginRegistry]")
+{
+    PluginRegistry plugins;
+    plugins.loadDirectory(FIGURES_PLUGIN_DIR);
+
+    const std::string builtinText = BenchmarkUtil::generateFigureText(PLUGIN_RECORD_COUNT, 42);
+    const std::string pluginText = generatePluginFigureText(PLUGIN_RECORD_COUNT, 42);
+
+    FigureStore builtinOnly;
+    const double builtinOnlySeconds =
+        BenchmarkUtil::measureSeconds([&] { builtinOnly = readPluginBenchmarkText(builtinText); });
+    BenchmarkUtil::report("built-in records, no plugins", builtinOnly.size(), "figures", builtinOnlySeconds);
+
+    StringToFigure::setPlugins(&plugins);
+
+    FigureStore builtins;
+    const double builtinSeconds =
+        BenchmarkUtil::measureSeconds([&] { builtins = readPluginBenchmarkText(builtinText); });
+    BenchmarkUtil::report("built-in records, plugins loaded", builtins.size(), "figures", builtinSeconds);
+
+    FigureStore added;
+    const double pluginSeconds = BenchmarkUtil::measureSeconds([&] { added = readPluginBenchmarkText(pluginText); });
+    BenchmarkUtil::report("plugin records", added.size(), "figures", pluginSeconds);
+
+    StringToFigure::setPlugins(nullptr);
+
+    REQUIRE(builtins.size() == builtinOnly.size());
+    REQUIRE(builtins.getAggregates().perimeterSum() == builtinOnly.getAggregates().perimeterSum());
+    REQUIRE(added.getAggregates().pluginCount() == PLUGIN_RECORD_COUNT);
+}
+
+TEST_CASE("Plugin perimeters: per-figure calls vs batch kernel", "[PluginRegistry]")
+{
+    PluginRegistry plugins;
+    plugins.loadDirectory(FIGURES_PLUGIN_DIR);
+    const PluginRegistry::TypeId trapezoid = *plugins.find("trapezoid");
+
+    std::vector<std::vector<double>> columns(4, std::vector<double>(PLUGIN_FIGURE_COUNT));
+    for (std::size_t i = 0; i < PLUGIN_FIGURE_COUNT; i++)
+    {
+        columns[0][i] = 10.0 + static_cast<double>(i % 100);
+        columns[1][i] = 4.0;
+        columns[2][i] = columns[3][i] = columns[0][i];
+    }
+    const std::array<std::span<const double>, 4> spans = {columns[0], columns[1], columns[2], columns[3]};
+    std::vector<double> out(PLUGIN_FIGURE_COUNT);
+
+    double single = 0;
+    const double singleSeconds = BenchmarkUtil::measureSeconds([&] {
+        for (std::size_t i = 0; i < PLUGIN_FIGURE_COUNT; i++)
+        {
+            single += plugins.perimeter(trapezoid,
+                                        std::array{columns[0][i], columns[1][i], columns[2][i], columns[3][i]});
+        }
+    });
+    BenchmarkUtil::report("per-figure plugin calls", PLUGIN_FIGURE_COUNT, "figures", singleSeconds);
+
+    const double batchSeconds = BenchmarkUtil::measureSeconds([&] { plugins.perimeters(trapezoid, spans, out); });
+    BenchmarkUtil::report("plugin batch kernel", PLUGIN_FIGURE_COUNT, "figures", batchSeconds);
+
+    double batch = 0;
+    for (const double perimeter : out)
+    {
+        batch += perimeter;
+    }
+    REQUIRE(batch == single);
+}
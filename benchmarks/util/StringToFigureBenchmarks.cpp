@@ -0,0 +1,83 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../src/figure/circle/Circle.hpp"
+#include "../../src/figure/rectangle/Rectangle.hpp"
+#include "../../src/figure/triangle/Triangle.hpp"
+#include "../../src/util/string_to_figure/StringToFigure.hpp"
+#include "../BenchmarkUtil.hpp"
+
+constexpr std::size_t LINE_COUNT = 10'000'000;
+
+// The stringstream/std::stod parser StringToFigure::createFigure used before switching to std::from_chars
+std::unique_ptr<Figure> legacyCreateFigure(const std::string &representation)
+{
+    std::stringstream sstream(representation);
+
+    std::string figureName;
+    std::vector<double> params;
+
+    sstream >> figureName;
+    std::ranges::transform(figureName, figureName.begin(), [](const unsigned char c) { return std::tolower(c); });
+
+    std::string temp;
+    while (sstream >> temp)
+    {
+        params.push_back(std::stod(temp));
+    }
+
+    if (figureName == "triangle" && params.size() == 3)
+    {
+        return std::make_unique<Triangle>(params.at(0), params.at(1), params.at(2));
+    }
+
+    if (figureName == "circle" && params.size() == 1)
+    {
+        return std::make_unique<Circle>(params.at(0));
+    }
+
+    if (figureName == "rectangle" && params.size() == 2)
+    {
+        return std::make_unique<Rectangle>(params.at(0), params.at(1));
+    }
+
+    return nullptr;
+}
+
+TEST_CASE("createFigure throughput: stringstream/stod vs from_chars", "[StringToFigure]")
+{
+    const std::string corpus = BenchmarkUtil::generateFigureText(LINE_COUNT, 7);
+
+    std::vector<std::string_view> lines;
+    lines.reserve(LINE_COUNT);
+    for (std::size_t begin = 0, end; begin < corpus.size(); begin = end + 1)
+    {
+        end = corpus.find('\n', begin);
+        lines.emplace_back(corpus.data() + begin, end - begin);
+    }
+
+    double legacyPerimeter = 0;
+    const double legacySeconds = BenchmarkUtil::measureSeconds([&] {
+        for (const std::string_view line : lines)
+        {
+            legacyPerimeter += legacyCreateFigure(std::string(line))->perimeter();
+        }
+    });
+    BenchmarkUtil::report("stringstream/stod", lines.size(), "lines", legacySeconds);
+
+    double perimeter = 0;
+    const double seconds = BenchmarkUtil::measureSeconds([&] {
+        for (const std::string_view line : lines)
+        {
+            perimeter += StringToFigure::createFigure(line)->perimeter();
+        }
+    });
+    BenchmarkUtil::report("from_chars", lines.size(), "lines", seconds);
+
+    REQUIRE(perimeter == legacyPerimeter);
+}
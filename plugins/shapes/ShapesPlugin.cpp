@@ -0,0 +1,136 @@
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <string_view>
+
+#include "../../src/util/figure_plugin/FigurePlugin.hpp"
+
+// Regular polygons, ellipses and trapezoids, added to the figures program as a plugin
+namespace
+{
+constexpr std::size_t MAX_NUMBER_SIZE = 24;
+
+bool isPositive(const double value)
+{
+    return value > 0 && std::isfinite(value);
+}
+
+char *format(const std::string_view name, const double *params, const unsigned paramN, char *buffer)
+{
+    std::memcpy(buffer, name.data(), name.size());
+    buffer += name.size();
+    for (unsigned i = 0; i < paramN; i++)
+    {
+        *buffer++ = ' ';
+        buffer = std::to_chars(buffer, buffer + MAX_NUMBER_SIZE, params[i]).ptr;
+    }
+    return buffer;
+}
+
+// Polygon: number of sides, side length
+double polygonPerimeter(const double *params)
+{
+    return params[0] * params[1];
+}
+
+int polygonValidate(const double *params)
+{
+    return params[0] >= 3 && params[0] == std::floor(params[0]) && isPositive(params[1]) &&
+           std::isfinite(polygonPerimeter(params));
+}
+
+void polygonPerimeters(const double *const *columns, const std::size_t count, double *out)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        out[i] = columns[0][i] * columns[1][i];
+    }
+}
+
+char *polygonFormat(const double *params, char *buffer)
+{
+    return format("Polygon", params, 2, buffer);
+}
+
+// Ellipse: semi-axes, perimeter by Ramanujan's second approximation
+double ellipsePerimeter(const double *params)
+{
+    const double a = params[0];
+    const double b = params[1];
+    const double h = (a - b) * (a - b) / ((a + b) * (a + b));
+
+    return M_PI * (a + b) * (1 + 3 * h / (10 + std::sqrt(4 - 3 * h)));
+}
+
+int ellipseValidate(const double *params)
+{
+    return isPositive(params[0]) && isPositive(params[1]) && std::isfinite(ellipsePerimeter(params));
+}
+
+void ellipsePerimeters(const double *const *columns, const std::size_t count, double *out)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        const double params[] = {columns[0][i], columns[1][i]};
+        out[i] = ellipsePerimeter(params);
+    }
+}
+
+char *ellipseFormat(const double *params, char *buffer)
+{
+    return format("Ellipse", params, 2, buffer);
+}
+
+// Trapezoid: the two parallel bases, then the two legs
+double trapezoidPerimeter(const double *params)
+{
+    return params[0] + params[1] + params[2] + params[3];
+}
+
+int trapezoidValidate(const double *params)
+{
+    for (unsigned i = 0; i < 4; i++)
+    {
+        if (!isPositive(params[i]))
+        {
+            return 0;
+        }
+    }
+
+    // Sliding one leg along the longer base leaves a triangle with sides |a - b|, c and d
+    const double difference = std::abs(params[0] - params[1]);
+    if (difference == 0)
+    {
+        return params[2] == params[3];
+    }
+
+    return difference < params[2] + params[3] && params[2] < difference + params[3] &&
+           params[3] < difference + params[2] && std::isfinite(trapezoidPerimeter(params));
+}
+
+void trapezoidPerimeters(const double *const *columns, const std::size_t count, double *out)
+{
+    for (std::size_t i = 0; i < count; i++)
+    {
+        out[i] = columns[0][i] + columns[1][i] + columns[2][i] + columns[3][i];
+    }
+}
+
+char *trapezoidFormat(const double *params, char *buffer)
+{
+    return format("Trapezoid", params, 4, buffer);
+}
+
+constexpr FiguresPluginType TYPES[] = {
+    {"polygon", 2, polygonValidate, polygonPerimeter, polygonPerimeters, polygonFormat},
+    {"ellipse", 2, ellipseValidate, ellipsePerimeter, ellipsePerimeters, ellipseFormat},
+    {"trapezoid", 4, trapezoidValidate, trapezoidPerimeter, trapezoidPerimeters, trapezoidFormat},
+};
+
+constexpr FiguresPlugin PLUGIN = {FIGURES_PLUGIN_ABI_VERSION, std::size(TYPES), TYPES};
+} // namespace
+
+extern "C" const FiguresPlugin *figuresPlugin()
+{
+    return &PLUGIN;
+}
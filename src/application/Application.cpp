@@ -1,11 +1,53 @@
 #include "Application.hpp"
 
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <limits>
 #include <sstream>
+#include <thread>
 
 #include "../factory/FigureFactory.hpp"
 #include "../factory/abstract_factory/AbstractFactory.hpp"
+#include "../factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../util/binary_figure_format/BinaryFigureFormat.hpp"
+#include "../util/ingest_report/IngestReport.hpp"
+#include "../pipeline/aggregate_stage/AggregateStage.hpp"
+#include "../pipeline/binary_figure_sink/BinaryFigureSink.hpp"
+#include "../pipeline/figure_pipeline/FigurePipeline.hpp"
+#include "../pipeline/filter_stage/FilterStage.hpp"
+#include "../pipeline/text_figure_sink/TextFigureSink.hpp"
+#include "../query/figure_query/FigureQuery.hpp"
+#include "../store/figure_deduplicator/FigureDeduplicator.hpp"
+#include "../store/figure_sorter/FigureSorter.hpp"
+#include "../util/memory_usage/MemoryUsage.hpp"
+#include "../util/string_to_figure/StringToFigure.hpp"
+#include "figure_pager/FigurePager.hpp"
+
+namespace
+{
+constexpr std::size_t BATCH_PAGE_SIZE = 1 << 16;
+
+// The plugin directory used when none is given on the command line
+std::string pluginDirectory(const std::string &option)
+{
+    const char *environment = std::getenv("FIGURES_PLUGINS");
+    return option.empty() && environment != nullptr ? environment : option;
+}
+
+// A random input without a seed draws one, which is reported so the run can be repeated with 'random:<seed>'
+void reportRandomSeed(const std::vector<std::string> &input, const FigureFactory &factory, std::ostream &log)
+{
+    const auto *random = dynamic_cast<const RandomFigureFactory *>(&factory);
+    if (random != nullptr && input.size() == 1)
+    {
+        log << "Random seed: " << random->getSeed() << '\n';
+    }
+}
+} // namespace
 
 void Application::split(const std::string &input, std::vector<std::string> &output)
 {
@@ -26,16 +68,213 @@ Application &Application::getInstance()
 
 void Application::run()
 {
+    if (const std::string directory = pluginDirectory(""); !directory.empty())
+    {
+        loadPlugins(directory, std::cout);
+    }
+
     loadFigures();
     menu();
 }
 
+void Application::loadPlugins(const std::string &directory, std::ostream &log)
+{
+    const std::size_t loaded = plugins.loadDirectory(directory);
+    StringToFigure::setPlugins(&plugins);
+
+    log << "Loaded " << loaded << " plugin figure type(s) from '" << directory << "'\n";
+}
+
+std::unique_ptr<FilterStage> Application::makeFilter(const CommandLine::Options &options)
+{
+    auto filter = std::make_unique<FilterStage>();
+    filter->setTypes(options.types);
+    filter->setPerimeterRange(options.minPerimeter.value_or(0),
+                              options.maxPerimeter.value_or(std::numeric_limits<double>::infinity()));
+
+    return filter;
+}
+
+void Application::runBatch(const CommandLine::Options &options)
+{
+    if (const std::string directory = pluginDirectory(options.plugins); !directory.empty())
+    {
+        loadPlugins(directory, std::cerr);
+    }
+
+    if (options.stream)
+    {
+        runStream(options);
+        return;
+    }
+
+    std::vector<std::string> input = options.input;
+    const std::unique_ptr<FigureFactory> factory = AbstractFactory::getFactory(input);
+    reportRandomSeed(input, *factory, std::cerr);
+
+    const std::size_t n = options.count.value_or(std::numeric_limits<std::size_t>::max());
+    const std::size_t created = factory->createBatch(n, figures);
+    const IngestReport *report = factory->getIngestReport();
+
+    if (options.count.has_value() && created < n && report == nullptr)
+    {
+        throw std::runtime_error("Cannot create figure #" + std::to_string(created));
+    }
+
+    if (report != nullptr)
+    {
+        displayIngestReport(std::cerr, *report);
+    }
+
+    if (options.filters())
+    {
+        makeFilter(options)->process(figures);
+    }
+
+    std::size_t queries = 0;
+    std::size_t sorts = 0;
+    for (const CommandLine::Operation operation : options.operations)
+    {
+        switch (operation)
+        {
+        case CommandLine::DISPLAY:
+        {
+            FigurePager pager(figures, options.offset, options.limit.value_or(std::numeric_limits<std::size_t>::max()),
+                              BATCH_PAGE_SIZE);
+            displayPages(pager, std::cerr, false);
+            break;
+        }
+        case CommandLine::STATS:
+            displayStats();
+            break;
+        case CommandLine::SUMMARY:
+            displaySummary();
+            break;
+        case CommandLine::MEMORY:
+            displayMemoryUsage();
+            break;
+        case CommandLine::QUERY:
+            runQuery(FigureQuery::parse(options.queries[queries++]), std::cerr, false);
+            break;
+        case CommandLine::SORT:
+            sort(options.sorts[sorts++], std::cerr);
+            break;
+        case CommandLine::DUPLICATES:
+            deduplicate(false, std::cerr);
+            break;
+        case CommandLine::DEDUPLICATE:
+            deduplicate(true, std::cerr);
+            break;
+        }
+    }
+
+    if (!options.save.empty())
+    {
+        save(options.save);
+    }
+}
+
+void Application::runStream(const CommandLine::Options &options)
+{
+    std::vector<std::string> input = options.input;
+    const std::unique_ptr<FigureFactory> factory = AbstractFactory::getFactory(input);
+    reportRandomSeed(input, *factory, std::cerr);
+
+    // Declared before the pipeline so the text sink writing to it is destroyed first
+    std::ofstream saveFile;
+    FigurePipeline pipeline;
+    const AggregateStage *aggregate = nullptr;
+    bool memory = false;
+
+    if (options.filters())
+    {
+        pipeline.addStage(makeFilter(options));
+    }
+
+    for (const CommandLine::Operation operation : options.operations)
+    {
+        switch (operation)
+        {
+        case CommandLine::DISPLAY:
+            pipeline.addSink(std::make_unique<TextFigureSink>(std::cout, true));
+            break;
+        case CommandLine::STATS:
+        case CommandLine::SUMMARY:
+            if (aggregate == nullptr)
+            {
+                aggregate = &static_cast<const AggregateStage &>(pipeline.addStage(std::make_unique<AggregateStage>()));
+            }
+            break;
+        case CommandLine::MEMORY:
+            memory = true;
+            break;
+        case CommandLine::QUERY:
+            throw std::invalid_argument("Queries need all figures loaded and cannot be streamed");
+        case CommandLine::SORT:
+            throw std::invalid_argument("Sorting needs all figures loaded and cannot be streamed");
+        case CommandLine::DUPLICATES:
+        case CommandLine::DEDUPLICATE:
+            throw std::invalid_argument("Finding duplicates needs all figures loaded and cannot be streamed");
+        }
+    }
+
+    if (CommandLine::isBinaryFile(options.save))
+    {
+        pipeline.addSink(std::make_unique<BinaryFigureSink>(options.save));
+    }
+    else if (!options.save.empty())
+    {
+        saveFile.open(options.save);
+        if (!saveFile.is_open())
+        {
+            throw std::runtime_error("Cannot open file: '" + options.save + "'");
+        }
+        pipeline.addSink(std::make_unique<TextFigureSink>(saveFile, false));
+    }
+
+    const std::size_t n = options.count.value_or(std::numeric_limits<std::size_t>::max());
+    const std::size_t created = pipeline.run(*factory, n);
+    const IngestReport *report = factory->getIngestReport();
+
+    if (options.count.has_value() && created < n && report == nullptr)
+    {
+        throw std::runtime_error("Cannot create figure #" + std::to_string(created));
+    }
+
+    if (saveFile.is_open() && saveFile.fail())
+    {
+        throw std::runtime_error("Cannot write file: '" + options.save + "'");
+    }
+
+    if (report != nullptr)
+    {
+        displayIngestReport(std::cerr, *report);
+    }
+
+    if (aggregate != nullptr)
+    {
+        const bool stats = std::ranges::find(options.operations, CommandLine::STATS) != options.operations.end();
+        displayStats(aggregate->getAggregates(), !stats);
+    }
+
+    if (memory)
+    {
+        std::cout << "------------------------\n";
+        std::cout << "Figures streamed: " << created << '\n';
+        std::cout << "Peak resident memory: " << MemoryUsage::peakResidentBytes() << " bytes\n";
+        std::cout << "------------------------\n";
+    }
+}
+
 void Application::loadFigures()
 {
     std::cout << "Select input method:\n";
-    std::cout << "\t<random>          - generates random figures\n";
+    std::cout << "\t<random ['seed']> - generates random figures, reproducibly when 'seed' is given\n";
     std::cout << "\t<stdin>           - enter figures from stdin\n";
     std::cout << "\t<file 'filename'> - reads figures from file with name 'filename'\n";
+    std::cout << "\t<file 'filename' lenient> - reads figures from file 'filename', skipping invalid figures\n";
+    std::cout << "\t<binary 'filename'> - reads figures from a binary figure file\n";
+    std::cout << "\t<parallel 'filename' ['threads']> - reads figures from file 'filename' on several threads\n";
 
     std::string input;
     std::getline(std::cin, input);
@@ -54,6 +293,7 @@ void Application::loadFigures()
     {
         throw std::runtime_error("Invalid input method");
     }
+    reportRandomSeed(splitInputs, *factory, std::cout);
 
     int n;
     do
@@ -75,14 +315,17 @@ void Application::loadFigures()
         }
     } while (n <= 0);
 
-    for (int i = 0; i < n; i++)
+    const std::size_t created = factory->createBatch(n, figures);
+    const IngestReport *report = factory->getIngestReport();
+
+    if (created < static_cast<std::size_t>(n) && report == nullptr)
     {
-        std::unique_ptr<Figure> figure = factory->create();
-        if (figure == nullptr)
-        {
-            throw std::runtime_error("Cannot create figure #" + std::to_string(i));
-        }
-        figures.push_back(std::move(figure));
+        throw std::runtime_error("Cannot create figure #" + std::to_string(created));
+    }
+
+    if (report != nullptr)
+    {
+        displayIngestReport(std::cout, *report);
     }
 
     if (splitInputs[0] == "stdin")
@@ -94,6 +337,28 @@ void Application::loadFigures()
     std::cout << "\n---Figures created---\n";
 }
 
+void Application::writeFigures(std::ostream &os, const FigureStore &figures, const bool numbered)
+{
+    TextFigureSink sink(os, numbered);
+    sink.write(figures);
+    sink.finish();
+}
+
+void Application::displayIngestReport(std::ostream &os, const IngestReport &report)
+{
+    os << "Accepted " << report.getAccepted() << " figures, skipped " << report.getRejected()
+              << " invalid figures\n";
+
+    for (unsigned code = 0; code < ParseError::CODE_NUM; code++)
+    {
+        const std::size_t rejected = report.getRejected(static_cast<ParseError::Code>(code));
+        if (rejected > 0)
+        {
+            os << '\t' << ParseError::describe(static_cast<ParseError::Code>(code)) << ": " << rejected << '\n';
+        }
+    }
+}
+
 void Application::menu()
 {
     int input;
@@ -104,7 +369,15 @@ void Application::menu()
         std::cout << "2. Clone a figure\n";
         std::cout << "3. Save figures to file\n";
         std::cout << "4. Delete figure\n";
-        std::cout << "5. Quit\n";
+        std::cout << "5. Show memory usage\n";
+        std::cout << "6. Save figures to binary file\n";
+        std::cout << "7. Renumber figures\n";
+        std::cout << "8. Query figures\n";
+        std::cout << "9. Rank figures by perimeter\n";
+        std::cout << "10. Show statistics\n";
+        std::cout << "11. Sort figures\n";
+        std::cout << "12. Find duplicate figures\n";
+        std::cout << "13. Quit\n";
 
         if (!(std::cin >> input))
         {
@@ -131,6 +404,30 @@ void Application::menu()
             deleteFigure();
             break;
         case 5:
+            displayMemoryUsage();
+            break;
+        case 6:
+            saveToBinaryFile();
+            break;
+        case 7:
+            renumberFigures();
+            break;
+        case 8:
+            queryFigures();
+            break;
+        case 9:
+            rankFigures();
+            break;
+        case 10:
+            displayStats();
+            break;
+        case 11:
+            sortFigures();
+            break;
+        case 12:
+            deduplicateFigures();
+            break;
+        case 13:
             quit = true;
             break;
         default:
@@ -141,14 +438,293 @@ void Application::menu()
 
 void Application::displayFigures() const
 {
+    std::cout << "Select what to display:\n";
+    std::cout << "\t<all>                       - every figure, a page at a time\n";
+    std::cout << "\t<summary>                   - only the number of figures of each type\n";
+    std::cout << "\t<range 'first' 'count' ['page size']> - 'count' figures from number 'first' on\n";
+
+    std::string input;
+    std::getline(std::cin, input);
+
+    std::vector<std::string> splitInputs;
+    split(input, splitInputs);
+
+    if (!splitInputs.empty() && splitInputs[0] == "summary" && splitInputs.size() == 1)
+    {
+        displaySummary();
+        return;
+    }
+
+    std::size_t first = 0;
+    std::size_t count = std::numeric_limits<std::size_t>::max();
+    std::size_t pageSize = FigurePager::DEFAULT_PAGE_SIZE;
+
+    const auto parse = [](const std::string &value, std::size_t &number) {
+        const std::from_chars_result result = std::from_chars(value.data(), value.data() + value.size(), number);
+        return result.ec == std::errc() && result.ptr == value.data() + value.size();
+    };
+
+    if (!splitInputs.empty() && splitInputs[0] == "range" && (splitInputs.size() == 3 || splitInputs.size() == 4))
+    {
+        if (!parse(splitInputs[1], first) || !parse(splitInputs[2], count) ||
+            (splitInputs.size() == 4 &&
+             (!parse(splitInputs[3], pageSize) || pageSize == 0 || pageSize > FigurePager::MAX_PAGE_SIZE)))
+        {
+            std::cout << "Invalid input. Please try again.\n";
+            return;
+        }
+    }
+    else if (!splitInputs.empty() && (splitInputs[0] != "all" || splitInputs.size() != 1))
+    {
+        std::cout << "Invalid input. Please try again.\n";
+        return;
+    }
+
+    try
+    {
+        FigurePager pager(figures, first, count, pageSize);
+
+        std::cout << "------------------------\n";
+        displayPages(pager, std::cout, true);
+        std::cout << "------------------------\n";
+    }
+    catch (std::exception &e)
+    {
+        std::cout << e.what() << '\n';
+    }
+}
+
+void Application::queryFigures() const
+{
+    std::cout << "Enter a query (leave blank to cancel):\n" << FigureQuery::SYNTAX;
+
+    std::string input;
+    std::getline(std::cin, input);
+
+    if (input.empty())
+    {
+        return;
+    }
+
+    try
+    {
+        const FigureQuery query = FigureQuery::parse(input);
+
+        std::cout << "------------------------\n";
+        runQuery(query, std::cout, true);
+        std::cout << "------------------------\n";
+    }
+    catch (std::invalid_argument &e)
+    {
+        std::cout << e.what() << '\n';
+    }
+}
+
+void Application::rankFigures()
+{
+    std::cout << "Select what to look up:\n";
+    std::cout << "\t<count 'min' 'max'> - number of figures with a perimeter in ['min', 'max']\n";
+    std::cout << "\t<rank 'k'>          - the figure with the 'k'-th smallest perimeter, counting from 0\n";
+    std::cout << "\t<list 'min' 'max'>  - figures with a perimeter in ['min', 'max'], smallest first\n";
+
+    std::string input;
+    std::getline(std::cin, input);
+
+    std::vector<std::string> splitInputs;
+    split(input, splitInputs);
+
+    const auto parse = [](const std::string &value, auto &number) {
+        const std::from_chars_result result = std::from_chars(value.data(), value.data() + value.size(), number);
+        return result.ec == std::errc() && result.ptr == value.data() + value.size();
+    };
+
+    double minPerimeter = 0;
+    double maxPerimeter = 0;
+    std::size_t rank = 0;
+
+    const bool isRange = splitInputs.size() == 3 && (splitInputs[0] == "count" || splitInputs[0] == "list") &&
+                         parse(splitInputs[1], minPerimeter) && parse(splitInputs[2], maxPerimeter);
+    const bool isRank = splitInputs.size() == 2 && splitInputs[0] == "rank" && parse(splitInputs[1], rank);
+
+    if (!isRange && !isRank)
+    {
+        std::cout << "Invalid input. Please try again.\n";
+        return;
+    }
+
+    if (!perimeterIndexed)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        perimeterIndex.build(figures);
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        perimeterIndexed = true;
+        std::cout << "Indexed " << perimeterIndex.size() << " figures in " << seconds * 1000 << " ms\n";
+    }
+
     std::cout << "------------------------\n";
-    for (unsigned i = 0; i < figures.size(); i++)
+
+    if (isRank)
     {
-        std::cout << i << ". " << *figures[i];
+        if (rank >= perimeterIndex.size())
+        {
+            std::cout << "No figure has rank " << rank << '\n';
+        }
+        else
+        {
+            const PerimeterIndex::Key key = perimeterIndex.kth(rank);
+            std::string line = std::to_string(key.number) + ". ";
+            figures.formatTo(key.number, line);
+            std::cout << line << '\n';
+        }
+    }
+    else if (splitInputs[0] == "count")
+    {
+        std::cout << perimeterIndex.countInRange(minPerimeter, maxPerimeter) << " figures\n";
+    }
+    else
+    {
+        std::vector<std::size_t> numbers;
+        perimeterIndex.forEachInRange(minPerimeter, maxPerimeter,
+                                      [&](const PerimeterIndex::Key key) { numbers.push_back(key.number); });
+
+        FigurePager pager(figures, std::move(numbers));
+        displayPages(pager, std::cout, true);
     }
+
     std::cout << "------------------------\n";
 }
 
+void Application::sortFigures()
+{
+    std::cout << "Enter a sort key, with a leading '-' for descending order (leave blank to cancel):\n";
+    std::cout << "\tkeys: " << FigureSorter::KEYS << '\n';
+
+    std::string input;
+    std::getline(std::cin, input);
+
+    if (input.empty())
+    {
+        return;
+    }
+
+    try
+    {
+        sort(input, std::cout);
+        std::cout << "---Figures sorted and renumbered!---\n";
+    }
+    catch (std::invalid_argument &e)
+    {
+        std::cout << e.what() << '\n';
+    }
+}
+
+void Application::sort(const std::string_view key, std::ostream &log)
+{
+    const bool descending = key.starts_with('-');
+    const FigureSorter::Key sortKey = FigureSorter::parseKey(descending ? key.substr(1) : key);
+    const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    const auto start = std::chrono::steady_clock::now();
+    FigureSorter::sort(figures, sortKey, descending, threads);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Sorting renumbers the figures, so the index is rebuilt on its next use
+    perimeterIndex.clear();
+    perimeterIndexed = false;
+
+    log << "Sorted " << figures.size() << " figures in " << seconds * 1000 << " ms\n";
+}
+
+void Application::deduplicateFigures()
+{
+    std::cout << "Select what to do with figures that repeat a lower-numbered figure:\n";
+    std::cout << "\t<count>  - only count them\n";
+    std::cout << "\t<remove> - delete them; the other figures keep their numbers\n";
+
+    std::string input;
+    std::getline(std::cin, input);
+
+    if (input != "count" && input != "remove")
+    {
+        std::cout << "Invalid input. Please try again.\n";
+        return;
+    }
+
+    deduplicate(input == "remove", std::cout);
+}
+
+void Application::deduplicate(const bool remove, std::ostream &log)
+{
+    const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    const auto start = std::chrono::steady_clock::now();
+    const FigureDeduplicator::Result result =
+        remove ? FigureDeduplicator::removeDuplicates(figures, threads) : FigureDeduplicator::count(figures, threads);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (remove && result.duplicates > 0)
+    {
+        // Removed figures would otherwise linger in the index
+        perimeterIndex.clear();
+        perimeterIndexed = false;
+    }
+
+    std::cout << "------------------------\n";
+    std::cout << "Figures: " << result.figures << '\n';
+    std::cout << "Distinct figures: " << result.distinct << '\n';
+    std::cout << (remove ? "Duplicates removed: " : "Duplicates: ") << result.duplicates << '\n';
+    std::cout << "------------------------\n";
+
+    log << "Checked " << result.figures << " figures for duplicates in " << seconds * 1000 << " ms\n";
+}
+
+void Application::runQuery(const FigureQuery &query, std::ostream &log, const bool interactive) const
+{
+    const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<std::size_t> numbers = query.execute(figures, threads);
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    log << "Found " << numbers.size() << " figures in " << seconds * 1000 << " ms\n";
+
+    FigurePager pager(figures, std::move(numbers), interactive ? FigurePager::DEFAULT_PAGE_SIZE : BATCH_PAGE_SIZE);
+    displayPages(pager, log, interactive);
+}
+
+void Application::displayPages(FigurePager &pager, std::ostream &log, const bool interactive)
+{
+    double seconds = 0;
+
+    while (pager.hasNext())
+    {
+        const auto start = std::chrono::steady_clock::now();
+        const std::string_view page = pager.next();
+        std::cout.write(page.data(), static_cast<std::streamsize>(page.size()));
+        std::cout.flush();
+        seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        if (interactive && pager.hasNext())
+        {
+            std::cout << "-- Press Enter for the next page or 'q' to stop --";
+
+            std::string answer;
+            if (!std::getline(std::cin, answer) || answer == "q")
+            {
+                break;
+            }
+        }
+    }
+
+    log << "Rendered " << pager.getRendered() << " figures in " << seconds * 1000 << " ms\n";
+}
+
+void Application::displaySummary() const
+{
+    displayStats(figures.getAggregates(), true);
+}
+
 void Application::cloneFigure()
 {
     std::cout << "Please provide the number, corresponding to the figure to be cloned: " << std::endl;
@@ -162,14 +738,18 @@ void Application::cloneFigure()
         return;
     }
 
-    if (input >= figures.size() || input < 0)
+    if (input < 0 || !figures.contains(input))
     {
         std::cout << "Invalid input. No figure corresponds to that number.\n";
         return;
     }
 
-    figures.push_back(std::unique_ptr<Figure>(figures.at(input)->clone()));
-    std::cout << "---Figure successfully cloned and added to the end of the list!---\n";
+    const FigureStore::Handle copy = figures.clone(input);
+    if (perimeterIndexed)
+    {
+        perimeterIndex.insert(figures.perimeterAt(copy.slot), copy.slot);
+    }
+    std::cout << "---Figure successfully cloned and added to the end of the list as number " << copy.slot << "!---\n";
 }
 
 void Application::deleteFigure()
@@ -185,14 +765,27 @@ void Application::deleteFigure()
         return;
     }
 
-    if (input >= figures.size() || input < 0)
+    if (input < 0 || !figures.contains(input))
     {
         std::cout << "Invalid input. No figure corresponds to that number.\n";
         return;
     }
 
-    figures.erase(figures.begin() + input);
-    std::cout << "---Figure successfully deleted!---\n";
+    if (perimeterIndexed)
+    {
+        perimeterIndex.erase(figures.perimeterAt(input), input);
+    }
+    figures.remove(input);
+    std::cout << "---Figure successfully deleted! The other figures keep their numbers.---\n";
+}
+
+void Application::renumberFigures()
+{
+    figures.compact();
+    // Compaction changes the figure numbers, so the index is rebuilt on its next use
+    perimeterIndex.clear();
+    perimeterIndexed = false;
+    std::cout << "---Figures renumbered without gaps!---\n";
 }
 
 void Application::saveToFile() const
@@ -212,11 +805,37 @@ void Application::saveToFile() const
             return;
         }
 
-        for (const std::unique_ptr<Figure> &figure : figures)
+        writeFigures(outputFile, figures, false);
+
+        if (outputFile.fail())
+        {
+            std::cout << "Warning: An error occurred while writing figures to file\n";
+        } else
+        {
+            std::cout << "---Figures successfully written!---\n";
+        }
+    }
+}
+
+void Application::saveToBinaryFile() const
+{
+    std::string input;
+
+    std::cout << "Enter output filename (leave blank to cancel): ";
+    std::getline(std::cin, input);
+
+    if (!input.empty())
+    {
+        std::ofstream outputFile(input, std::ios::binary);
+
+        if (!outputFile.is_open())
         {
-            outputFile << *figure;
+            std::cout << "Error opening file. Please try again.\n";
+            return;
         }
 
+        BinaryFigureFormat::write(outputFile, figures);
+
         if (outputFile.fail())
         {
             std::cout << "Warning: An error occurred while writing figures to file\n";
@@ -225,4 +844,76 @@ void Application::saveToFile() const
             std::cout << "---Figures successfully written!---\n";
         }
     }
-}
\ No newline at end of file
+}
+
+void Application::displayMemoryUsage() const
+{
+    const FigureStore::MemoryReport report = figures.memoryReport();
+
+    std::cout << "------------------------\n";
+    std::cout << "Figures: " << report.figureCount << '\n';
+    std::cout << "Columnar store: " << report.storeBytes << " bytes\n";
+    std::cout << "Pointer-per-figure layout (estimated): " << report.pointerLayoutBytes << " bytes\n";
+
+    if (report.figureCount > 0)
+    {
+        const double count = static_cast<double>(report.figureCount);
+        std::cout << "Bytes per figure: " << static_cast<double>(report.storeBytes) / count << " (store) vs "
+                  << static_cast<double>(report.pointerLayoutBytes) / count << " (pointer layout)\n";
+    }
+    std::cout << "Peak resident memory: " << MemoryUsage::peakResidentBytes() << " bytes\n";
+    std::cout << "------------------------\n";
+}
+
+void Application::displayStats() const
+{
+    displayStats(figures.getAggregates(), false);
+}
+
+void Application::displayStats(const FigureAggregates &aggregates, const bool countsOnly)
+{
+    std::cout << "------------------------\n";
+    std::cout << "Figures: " << aggregates.count() << '\n';
+    std::cout << "Triangles: " << aggregates.count(FigureUtil::TRIANGLE) << '\n';
+    std::cout << "Circles: " << aggregates.count(FigureUtil::CIRCLE) << '\n';
+    std::cout << "Rectangles: " << aggregates.count(FigureUtil::RECTANGLE) << '\n';
+    if (aggregates.pluginCount() > 0)
+    {
+        std::cout << "Plugin figures: " << aggregates.pluginCount() << '\n';
+    }
+
+    if (aggregates.count() > 0 && !countsOnly)
+    {
+        std::cout << "Perimeter sum: " << aggregates.perimeterSum() << '\n';
+        std::cout << "Perimeter min: " << aggregates.minPerimeter() << '\n';
+        std::cout << "Perimeter max: " << aggregates.maxPerimeter() << '\n';
+        std::cout << "Perimeter mean: " << aggregates.meanPerimeter() << '\n';
+    }
+    std::cout << "------------------------\n";
+}
+
+void Application::save(const std::string &filename) const
+{
+    const bool binary = CommandLine::isBinaryFile(filename);
+    std::ofstream outputFile(filename, binary ? std::ios::binary : std::ios::out);
+
+    if (!outputFile.is_open())
+    {
+        throw std::runtime_error("Cannot open file: '" + filename + "'");
+    }
+
+    if (binary)
+    {
+        BinaryFigureFormat::write(outputFile, figures);
+    }
+    else
+    {
+        writeFigures(outputFile, figures, false);
+    }
+
+    outputFile.flush();
+    if (outputFile.fail())
+    {
+        throw std::runtime_error("Cannot write file: '" + filename + "'");
+    }
+}
@@ -1,33 +1,70 @@
 #ifndef FIGURES_APPLICATION_HPP
 #define FIGURES_APPLICATION_HPP
 
-#include "../figure/Figure.hpp"
+#include "../pipeline/filter_stage/FilterStage.hpp"
+#include "../store/figure_aggregates/FigureAggregates.hpp"
+#include "../store/figure_store/FigureStore.hpp"
+#include "../store/perimeter_index/PerimeterIndex.hpp"
+#include "../util/plugin_registry/PluginRegistry.hpp"
+#include "command_line/CommandLine.hpp"
 
+#include <memory>
+#include <ostream>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <memory>
+
+class FigurePager;
+class FigureQuery;
+class IngestReport;
 
 class Application
 {
     static void split(const std::string &input, std::vector<std::string> &output);
+    static void writeFigures(std::ostream &os, const FigureStore &figures, bool numbered);
+    static void displayIngestReport(std::ostream &os, const IngestReport &report);
+    static void displayStats(const FigureAggregates &aggregates, bool countsOnly);
+    static void displayPages(FigurePager &pager, std::ostream &log, bool interactive);
+    static std::unique_ptr<FilterStage> makeFilter(const CommandLine::Options &options);
     static Application application;
 
-    std::vector<std::unique_ptr<Figure>> figures;
+    // Declared before the figures, so the plugin figures among them never outlive the types they come from
+    PluginRegistry plugins;
+    FigureStore figures;
+    // Built on first use, then kept up to date by cloneFigure and deleteFigure
+    PerimeterIndex perimeterIndex;
+    bool perimeterIndexed = false;
 
     Application() = default;
 
+    void loadPlugins(const std::string &directory, std::ostream &log);
     void loadFigures();
     void menu();
     void displayFigures() const;
     void cloneFigure();
     void deleteFigure();
+    void renumberFigures();
     void saveToFile() const;
+    void saveToBinaryFile() const;
+    void displayMemoryUsage() const;
+    void displayStats() const;
+    void displaySummary() const;
+    void queryFigures() const;
+    void rankFigures();
+    void sortFigures();
+    void sort(std::string_view key, std::ostream &log);
+    void deduplicateFigures();
+    void deduplicate(bool remove, std::ostream &log);
+    void runQuery(const FigureQuery &query, std::ostream &log, bool interactive) const;
+    void save(const std::string &filename) const;
+    void runStream(const CommandLine::Options &options);
 
   public:
     Application(const Application &) = delete;
     Application &operator=(const Application &) = delete;
 
     void run();
+    void runBatch(const CommandLine::Options &options);
     static Application &getInstance();
 };
 
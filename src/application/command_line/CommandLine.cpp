@@ -0,0 +1,235 @@
+#include "CommandLine.hpp"
+
+#include <charconv>
+#include <limits>
+#include <stdexcept>
+
+std::vector<std::string> CommandLine::splitInput(const std::string_view method)
+{
+    std::vector<std::string> parts;
+
+    std::size_t begin = 0;
+    for (std::size_t end = method.find(':'); end != std::string_view::npos; end = method.find(':', begin))
+    {
+        parts.emplace_back(method.substr(begin, end - begin));
+        begin = end + 1;
+    }
+    parts.emplace_back(method.substr(begin));
+
+    return parts;
+}
+
+std::size_t CommandLine::parseCount(const std::string_view value)
+{
+    std::size_t count = 0;
+    const std::from_chars_result result = std::from_chars(value.data(), value.data() + value.size(), count);
+
+    if (result.ec != std::errc() || result.ptr != value.data() + value.size() || count == 0)
+    {
+        throw std::invalid_argument("Invalid figure count: '" + std::string(value) + "'");
+    }
+
+    return count;
+}
+
+std::size_t CommandLine::parseOffset(const std::string_view value)
+{
+    std::size_t offset = 0;
+    const std::from_chars_result result = std::from_chars(value.data(), value.data() + value.size(), offset);
+
+    if (result.ec != std::errc() || result.ptr != value.data() + value.size())
+    {
+        throw std::invalid_argument("Invalid offset: '" + std::string(value) + "'");
+    }
+
+    return offset;
+}
+
+CommandLine::Operation CommandLine::parseOperation(const std::string_view value)
+{
+    if (value == "display")
+    {
+        return DISPLAY;
+    }
+
+    if (value == "stats")
+    {
+        return STATS;
+    }
+
+    if (value == "memory")
+    {
+        return MEMORY;
+    }
+
+    if (value == "summary")
+    {
+        return SUMMARY;
+    }
+
+    if (value == "duplicates")
+    {
+        return DUPLICATES;
+    }
+
+    if (value == "dedup")
+    {
+        return DEDUPLICATE;
+    }
+
+    throw std::invalid_argument("Unknown operation: '" + std::string(value) + "'");
+}
+
+FigureUtil::FigureType CommandLine::parseType(const std::string_view value)
+{
+    const std::expected<FigureUtil::FigureType, ParseError::Code> type = FigureUtil::tryStrToFigure(std::string(value));
+
+    if (!type.has_value())
+    {
+        throw std::invalid_argument("Unknown figure type: '" + std::string(value) + "'");
+    }
+
+    return *type;
+}
+
+double CommandLine::parsePerimeter(const std::string_view value)
+{
+    double perimeter = 0;
+    const std::from_chars_result result = std::from_chars(value.data(), value.data() + value.size(), perimeter);
+
+    if (result.ec != std::errc() || result.ptr != value.data() + value.size() || !(perimeter >= 0))
+    {
+        throw std::invalid_argument("Invalid perimeter: '" + std::string(value) + "'");
+    }
+
+    return perimeter;
+}
+
+bool CommandLine::Options::filters() const
+{
+    return !types.empty() || minPerimeter.has_value() || maxPerimeter.has_value();
+}
+
+CommandLine::Options CommandLine::parse(const std::span<const char *const> args)
+{
+    Options options;
+
+    for (std::size_t i = 0; i < args.size(); i++)
+    {
+        const std::string_view option = args[i];
+
+        if (option == "--help")
+        {
+            options.help = true;
+            return options;
+        }
+
+        if (option == "--stream")
+        {
+            options.stream = true;
+            continue;
+        }
+
+        if (option != "--input" && option != "--count" && option != "--op" && option != "--save" &&
+            option != "--type" && option != "--min-perimeter" && option != "--max-perimeter" && option != "--offset" &&
+            option != "--limit" && option != "--query" && option != "--sort" && option != "--plugins")
+        {
+            throw std::invalid_argument("Unknown option: '" + std::string(option) + "'");
+        }
+
+        if (i + 1 == args.size())
+        {
+            throw std::invalid_argument("Missing value for '" + std::string(option) + "'");
+        }
+
+        const std::string_view value = args[++i];
+
+        if (option == "--input")
+        {
+            options.input = splitInput(value);
+        }
+        else if (option == "--count")
+        {
+            options.count = value == "all" ? std::nullopt : std::optional(parseCount(value));
+        }
+        else if (option == "--op")
+        {
+            options.operations.push_back(parseOperation(value));
+        }
+        else if (option == "--save")
+        {
+            options.save = value;
+        }
+        else if (option == "--type")
+        {
+            options.types.push_back(parseType(value));
+        }
+        else if (option == "--min-perimeter")
+        {
+            options.minPerimeter = parsePerimeter(value);
+        }
+        else if (option == "--offset")
+        {
+            options.offset = parseOffset(value);
+        }
+        else if (option == "--limit")
+        {
+            options.limit = parseCount(value);
+        }
+        else if (option == "--query")
+        {
+            options.queries.emplace_back(value);
+            options.operations.push_back(QUERY);
+        }
+        else if (option == "--sort")
+        {
+            options.sorts.emplace_back(value);
+            options.operations.push_back(SORT);
+        }
+        else if (option == "--plugins")
+        {
+            options.plugins = value;
+        }
+        else
+        {
+            options.maxPerimeter = parsePerimeter(value);
+        }
+    }
+
+    if (options.input.empty())
+    {
+        throw std::invalid_argument("Missing '--input'");
+    }
+
+    if (options.input.front() == "random" && !options.count.has_value())
+    {
+        throw std::invalid_argument("Random input needs a '--count'");
+    }
+
+    if (options.minPerimeter.value_or(0) > options.maxPerimeter.value_or(std::numeric_limits<double>::infinity()))
+    {
+        throw std::invalid_argument("'--min-perimeter' exceeds '--max-perimeter'");
+    }
+
+    if (options.stream && (options.offset != 0 || options.limit.has_value()))
+    {
+        throw std::invalid_argument("'--offset' and '--limit' cannot be used with '--stream'");
+    }
+
+    if (options.stream && !options.queries.empty())
+    {
+        throw std::invalid_argument("'--query' cannot be used with '--stream'");
+    }
+
+    if (options.stream && !options.sorts.empty())
+    {
+        throw std::invalid_argument("'--sort' cannot be used with '--stream'");
+    }
+
+    return options;
+}
+
+bool CommandLine::isBinaryFile(const std::string_view filename)
+{
+    return filename.ends_with(".bin") || filename.ends_with(".figb");
+}
@@ -0,0 +1,91 @@
+#ifndef FIGURES_COMMANDLINE_HPP
+#define FIGURES_COMMANDLINE_HPP
+
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../util/figure_util/FigureUtil.hpp"
+
+class CommandLine
+{
+  public:
+    enum Operation
+    {
+        DISPLAY = 0,
+        STATS,
+        MEMORY,
+        SUMMARY,
+        QUERY,
+        SORT,
+        DUPLICATES,
+        DEDUPLICATE
+    };
+
+    struct Options
+    {
+        bool help = false;
+        std::vector<std::string> input;
+        std::optional<std::size_t> count;
+        std::vector<Operation> operations;
+        std::string save;
+        bool stream = false;
+        std::vector<FigureUtil::FigureType> types;
+        std::optional<double> minPerimeter;
+        std::optional<double> maxPerimeter;
+        std::size_t offset = 0;
+        std::optional<std::size_t> limit;
+        std::vector<std::string> queries;
+        std::vector<std::string> sorts;
+        std::string plugins;
+
+        bool filters() const;
+    };
+
+    static constexpr std::string_view USAGE =
+        "Usage: figures [--input <method>] [--count <n>|all] [--op <operation>]... [--save <file>]\n"
+        "               [--type <figure>]... [--min-perimeter <p>] [--max-perimeter <p>] [--stream]\n"
+        "               [--offset <number>] [--limit <n>] [--query <query>] [--sort [-]<key>] [--plugins <dir>]\n"
+        "Without arguments the interactive menu is started.\n"
+        "\n"
+        "  --input <method>  random[:seed], stdin, file:<name>[:lenient], binary:<name>, parallel:<name>[:threads]\n"
+        "  --count <n>|all   number of figures to load (default: all, not allowed for random)\n"
+        "  --op <operation>  run an operation on the loaded figures, may be repeated: display, stats, summary,\n"
+        "                    memory, duplicates (count them) or dedup (remove them)\n"
+        "  --offset <number> display figures from this number on\n"
+        "  --limit <n>       display at most n figures\n"
+        "  --query <query>   display the figures matching a query, for example\n"
+        "                    'triangle perimeter>1e6 sort=-perimeter limit=100'\n"
+        "  --sort [-]<key>   sort and renumber the figures by type, perimeter, a, b, c, radius, width or height,\n"
+        "                    descending with a leading '-'\n"
+        "  --save <file>     save the figures, as binary when the name ends in .bin or .figb\n"
+        "  --type <figure>   keep only figures of this type, may be repeated\n"
+        "  --min-perimeter <p>  keep only figures with at least this perimeter\n"
+        "  --max-perimeter <p>  keep only figures with at most this perimeter\n"
+        "  --stream          process the figures in fixed-size chunks instead of loading them all\n"
+        "  --plugins <dir>   load figure type plugins from this directory (default: $FIGURES_PLUGINS)\n"
+        "  --help            print this message\n";
+
+  private:
+    static std::vector<std::string> splitInput(std::string_view method);
+
+    static std::size_t parseCount(std::string_view value);
+
+    static std::size_t parseOffset(std::string_view value);
+
+    static Operation parseOperation(std::string_view value);
+
+    static FigureUtil::FigureType parseType(std::string_view value);
+
+    static double parsePerimeter(std::string_view value);
+
+  public:
+    static Options parse(std::span<const char *const> args);
+
+    static bool isBinaryFile(std::string_view filename);
+};
+
+#endif // FIGURES_COMMANDLINE_HPP
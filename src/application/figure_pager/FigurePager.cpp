@@ -0,0 +1,83 @@
+#include "FigurePager.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+void checkPageSize(const std::size_t pageSize)
+{
+    if (pageSize == 0 || pageSize > FigurePager::MAX_PAGE_SIZE)
+    {
+        throw std::invalid_argument("Page size must be between 1 and " + std::to_string(FigurePager::MAX_PAGE_SIZE));
+    }
+}
+} // namespace
+
+FigurePager::FigurePager(const FigureStore &figures, const std::size_t first, const std::size_t limit,
+                         const std::size_t pageSize)
+    : figures(figures), slot(first), remaining(limit), pageSize(pageSize), listed(false)
+{
+    checkPageSize(pageSize);
+
+    reservePage(std::min(limit, first < figures.slotCount() ? figures.slotCount() - first : 0));
+    skipVacant();
+}
+
+FigurePager::FigurePager(const FigureStore &figures, std::vector<std::size_t> numbers, const std::size_t pageSize)
+    : figures(figures), slot(0), remaining(numbers.size()), pageSize(pageSize), numbers(std::move(numbers)),
+      listed(true)
+{
+    checkPageSize(pageSize);
+
+    reservePage(this->numbers.size());
+}
+
+void FigurePager::skipVacant()
+{
+    while (slot < figures.slotCount() && !figures.contains(slot))
+    {
+        slot++;
+    }
+}
+
+void FigurePager::reservePage(const std::size_t figureCount)
+{
+    page.reserve(std::min(pageSize, figureCount) * (Figure::MAX_FORMATTED_SIZE + 24));
+}
+
+bool FigurePager::hasNext() const
+{
+    return remaining > 0 && (listed || slot < figures.slotCount());
+}
+
+std::string_view FigurePager::next()
+{
+    page.clear();
+
+    for (std::size_t n = 0; n < pageSize && hasNext(); n++, remaining--, rendered++)
+    {
+        const std::size_t number = listed ? numbers[rendered] : slot;
+
+        char digits[24];
+        page.append(digits, std::to_chars(digits, digits + sizeof(digits), number).ptr);
+        page += ". ";
+        figures.formatTo(number, page);
+        page += '\n';
+
+        if (!listed)
+        {
+            slot++;
+            skipVacant();
+        }
+    }
+
+    return page;
+}
+
+std::size_t FigurePager::getRendered() const
+{
+    return rendered;
+}
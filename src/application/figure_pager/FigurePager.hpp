@@ -0,0 +1,45 @@
+#ifndef FIGURES_FIGUREPAGER_HPP
+#define FIGURES_FIGUREPAGER_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../store/figure_store/FigureStore.hpp"
+
+// Renders a range or a list of numbered figures a page at a time, each page into one buffer so it can be written
+// at once
+class FigurePager
+{
+  public:
+    static constexpr std::size_t DEFAULT_PAGE_SIZE = 1000;
+    static constexpr std::size_t MAX_PAGE_SIZE = 1 << 20;
+
+  private:
+    const FigureStore &figures;
+    std::size_t slot;
+    std::size_t remaining;
+    const std::size_t pageSize;
+    std::size_t rendered = 0;
+    std::string page;
+    const std::vector<std::size_t> numbers;
+    const bool listed;
+
+    void skipVacant();
+    // Reserves a page buffer for at most figureCount figures, never more than one page
+    void reservePage(std::size_t figureCount);
+
+  public:
+    // Throws std::invalid_argument unless 0 < pageSize <= MAX_PAGE_SIZE
+    FigurePager(const FigureStore &figures, std::size_t first, std::size_t limit,
+                std::size_t pageSize = DEFAULT_PAGE_SIZE);
+    FigurePager(const FigureStore &figures, std::vector<std::size_t> numbers,
+                std::size_t pageSize = DEFAULT_PAGE_SIZE);
+
+    bool hasNext() const;
+    std::string_view next();
+    std::size_t getRendered() const;
+};
+
+#endif // FIGURES_FIGUREPAGER_HPP
@@ -0,0 +1,34 @@
+#include "FigureFactory.hpp"
+
+#include "../store/figure_arena/FigureArena.hpp"
+#include "../store/figure_store/FigureStore.hpp"
+
+Figure *FigureFactory::createIn(FigureArena &arena)
+{
+    const std::unique_ptr<Figure> figure = create();
+
+    return figure == nullptr ? nullptr : arena.copy(*figure);
+}
+
+std::size_t FigureFactory::createBatch(const std::size_t n, FigureStore &sink)
+{
+    std::size_t created = 0;
+    while (created < n)
+    {
+        const std::unique_ptr<Figure> figure = create();
+        if (figure == nullptr)
+        {
+            break;
+        }
+
+        sink.add(*figure);
+        created++;
+    }
+
+    return created;
+}
+
+const IngestReport *FigureFactory::getIngestReport() const
+{
+    return nullptr;
+}
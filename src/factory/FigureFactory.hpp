@@ -1,13 +1,24 @@
 #ifndef FIGURES_FIGUREFACTORY_HPP
 #define FIGURES_FIGUREFACTORY_HPP
 
+#include <cstddef>
+#include <memory>
+
 #include "../figure/Figure.hpp"
 
+class FigureArena;
+class FigureStore;
+class IngestReport;
+
 class FigureFactory
 {
   public:
     virtual std::unique_ptr<Figure> create() = 0;
+    // The next figure allocated from arena, or nullptr at the end of the input
+    virtual Figure *createIn(FigureArena &arena);
+    virtual std::size_t createBatch(std::size_t n, FigureStore &sink);
+    virtual const IngestReport *getIngestReport() const;
     virtual ~FigureFactory() = default;
 };
 
-#endif // FIGURES_FIGUREFACTORY_HPP
\ No newline at end of file
+#endif // FIGURES_FIGUREFACTORY_HPP
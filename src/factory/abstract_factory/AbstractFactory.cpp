@@ -1,5 +1,14 @@
 #include "AbstractFactory.hpp"
 
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <thread>
+
+#include "../../util/mapped_file/MappedFile.hpp"
+#include "../binary_figure_factory/BinaryFigureFactory.hpp"
+#include "../mmap_figure_factory/MmapFigureFactory.hpp"
+#include "../parallel_figure_factory/ParallelFigureFactory.hpp"
 #include "../random_figure_factory/RandomFigureFactory.hpp"
 #include "../stream_figure_factory/StreamFigureFactory.hpp"
 
@@ -12,7 +21,26 @@ std::unique_ptr<FigureFactory> AbstractFactory::getFactory(std::vector<std::stri
 
     if (inputType.at(0) == "random")
     {
-        return std::make_unique<RandomFigureFactory>();
+        if (inputType.size() > 2)
+        {
+            throw std::invalid_argument("Invalid number of arguments for 'random' choice");
+        }
+
+        const unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+        if (inputType.size() == 1)
+        {
+            return std::make_unique<RandomFigureFactory>(RandomFigureFactory::makeSeed(), threads);
+        }
+
+        std::uint64_t seed = 0;
+        const std::string &value = inputType.at(1);
+        const std::from_chars_result result = std::from_chars(value.data(), value.data() + value.size(), seed);
+        if (result.ec != std::errc() || result.ptr != value.data() + value.size())
+        {
+            throw std::invalid_argument("Invalid seed: '" + value + "'");
+        }
+
+        return std::make_unique<RandomFigureFactory>(seed, threads);
     }
 
     if (inputType.at(0) == "stdin")
@@ -23,11 +51,18 @@ std::unique_ptr<FigureFactory> AbstractFactory::getFactory(std::vector<std::stri
 
     if (inputType.at(0) == "file")
     {
-        if (inputType.size() != 2)
+        const bool lenient = inputType.size() == 3 && inputType.at(2) == "lenient";
+
+        if (inputType.size() != 2 && !lenient)
         {
             throw std::invalid_argument("Invalid number of arguments for 'file' choice");
         }
 
+        if (MappedFile::isRegularFile(inputType.at(1)))
+        {
+            return std::make_unique<MmapFigureFactory>(inputType.at(1), lenient);
+        }
+
         std::unique_ptr<std::ifstream> file = std::make_unique<std::ifstream>(inputType.at(1));
 
         if (!file->is_open())
@@ -35,7 +70,38 @@ std::unique_ptr<FigureFactory> AbstractFactory::getFactory(std::vector<std::stri
             throw std::runtime_error("Cannot open file: '" + inputType.at(1) + "'");
         }
 
-        return std::make_unique<StreamFigureFactory>(std::move(file));
+        return std::make_unique<StreamFigureFactory>(std::move(file), lenient);
+    }
+
+    if (inputType.at(0) == "binary")
+    {
+        if (inputType.size() != 2)
+        {
+            throw std::invalid_argument("Invalid number of arguments for 'binary' choice");
+        }
+
+        return std::make_unique<BinaryFigureFactory>(inputType.at(1));
+    }
+
+    if (inputType.at(0) == "parallel")
+    {
+        if (inputType.size() != 2 && inputType.size() != 3)
+        {
+            throw std::invalid_argument("Invalid number of arguments for 'parallel' choice");
+        }
+
+        unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+        if (inputType.size() == 3)
+        {
+            const std::string &value = inputType.at(2);
+            const std::from_chars_result result = std::from_chars(value.data(), value.data() + value.size(), threads);
+            if (result.ec != std::errc() || result.ptr != value.data() + value.size() || threads == 0)
+            {
+                throw std::invalid_argument("Invalid number of threads: '" + value + "'");
+            }
+        }
+
+        return std::make_unique<ParallelFigureFactory>(inputType.at(1), threads);
     }
 
     throw std::invalid_argument("Invalid input");
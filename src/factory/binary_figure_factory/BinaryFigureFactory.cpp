@@ -0,0 +1,127 @@
+#include "BinaryFigureFactory.hpp"
+
+#include <algorithm>
+#include <array>
+#include <stdexcept>
+#include <string>
+
+#include "../../figure/plugin_figure/PluginFigure.hpp"
+
+#include "../../store/figure_store/FigureStore.hpp"
+#include "../../util/figure_registry/FigureRegistry.hpp"
+#include "../../util/string_to_figure/StringToFigure.hpp"
+
+BinaryFigureFactory::BinaryFigureFactory(const std::string &filename)
+    : file(filename), header(BinaryFigureFormat::readHeader(file.view()))
+{
+    for (unsigned type = 0; type < FigureUtil::FIGURE_NUM; type++)
+    {
+        const auto figureType = static_cast<FigureUtil::FigureType>(type);
+        for (unsigned param = 0; param < FigureRegistry::params(figureType); param++)
+        {
+            columns[type][param] = file.view().data() + BinaryFigureFormat::columnOffset(header, figureType, param);
+        }
+    }
+
+    if (header.version == BinaryFigureFormat::PLUGIN_VERSION)
+    {
+        resolvePluginTypes();
+    }
+}
+
+void BinaryFigureFactory::resolvePluginTypes()
+{
+    const BinaryFigureFormat::PluginTable table = BinaryFigureFormat::readPluginTable(file.view(), header);
+
+    plugins = StringToFigure::getPlugins();
+    for (const BinaryFigureFormat::PluginType &type : table.types)
+    {
+        const std::optional<PluginRegistry::TypeId> id =
+            plugins != nullptr ? plugins->find(type.name) : std::nullopt;
+        if (!id.has_value())
+        {
+            throw std::runtime_error("Binary figure file needs the plugin figure type '" + std::string(type.name) +
+                                     "'");
+        }
+
+        if (plugins->params(*id) != type.params)
+        {
+            throw std::runtime_error("Binary figure file has " + std::to_string(type.params) +
+                                     " parameters for the plugin figure type '" + std::string(type.name) + "'");
+        }
+        pluginTypes.push_back(*id);
+    }
+
+    pluginRecord = file.view().data() + table.recordOffset;
+}
+
+template <typename Consumer> bool BinaryFigureFactory::readWith(Consumer &&consumer)
+{
+    if (next == header.figureCount)
+    {
+        return false;
+    }
+
+    const auto typeByte = static_cast<std::uint8_t>(file.view()[BinaryFigureFormat::HEADER_SIZE + next]);
+    if (typeByte == FigureStore::PLUGIN)
+    {
+        next++;
+
+        const PluginRegistry::TypeId id = pluginTypes[BinaryFigureFormat::readUint32(pluginRecord)];
+        pluginRecord += sizeof(std::uint32_t);
+
+        std::array<double, FIGURES_PLUGIN_MAX_PARAMS> params{};
+        const unsigned paramCount = plugins->params(id);
+        for (unsigned param = 0; param < paramCount; param++, pluginRecord += sizeof(double))
+        {
+            params[param] = BinaryFigureFormat::readDouble(pluginRecord);
+        }
+
+        consumer(PluginFigure(*plugins, id, std::span<const double>(params.data(), paramCount)));
+        return true;
+    }
+
+    const auto type = static_cast<FigureUtil::FigureType>(typeByte);
+    const std::uint64_t row = rows[type]++;
+    next++;
+
+    FigureRegistry::visit(type, [&]<typename T>() {
+        std::array<double, T::PARAMS> params{};
+        for (unsigned param = 0; param < T::PARAMS; param++)
+        {
+            params[param] = BinaryFigureFormat::readDouble(columns[type][param] + row * sizeof(double));
+        }
+
+        consumer(FigureRegistry::make<T>(params));
+    });
+
+    return true;
+}
+
+std::unique_ptr<Figure> BinaryFigureFactory::create()
+{
+    std::unique_ptr<Figure> figure;
+
+    readWith([&figure]<typename T>(const T &value) { figure = std::make_unique<T>(value); });
+
+    return figure;
+}
+
+std::size_t BinaryFigureFactory::createBatch(const std::size_t n, FigureStore &sink)
+{
+    const std::size_t count = std::min<std::uint64_t>(n, header.figureCount - next);
+    sink.reserve(sink.size() + count);
+
+    std::size_t created = 0;
+    while (created < count && readWith([&sink](const auto &figure) { sink.add(figure); }))
+    {
+        created++;
+    }
+
+    return created;
+}
+
+std::size_t BinaryFigureFactory::getFigureCount() const
+{
+    return header.figureCount;
+}
@@ -0,0 +1,42 @@
+#ifndef FIGURES_BINARYFIGUREFACTORY_HPP
+#define FIGURES_BINARYFIGUREFACTORY_HPP
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../util/binary_figure_format/BinaryFigureFormat.hpp"
+#include "../../util/figure_util/FigureUtil.hpp"
+#include "../../util/plugin_registry/PluginRegistry.hpp"
+#include "../../util/mapped_file/MappedFile.hpp"
+#include "../FigureFactory.hpp"
+
+class BinaryFigureFactory final : public FigureFactory
+{
+  private:
+    MappedFile file;
+    BinaryFigureFormat::Header header;
+    std::array<std::array<const char *, FigureUtil::MAX_FIGURE_PARAMS>, FigureUtil::FIGURE_NUM> columns{};
+    std::array<std::uint64_t, FigureUtil::FIGURE_NUM> rows{};
+    std::uint64_t next = 0;
+    // Plugin figure types of the file resolved against the loaded plugins, and the next plugin figure record
+    const PluginRegistry *plugins = nullptr;
+    std::vector<PluginRegistry::TypeId> pluginTypes;
+    const char *pluginRecord = nullptr;
+
+    void resolvePluginTypes();
+
+    template <typename Consumer> bool readWith(Consumer &&consumer);
+
+  public:
+    explicit BinaryFigureFactory(const std::string &filename);
+
+    std::unique_ptr<Figure> create() override;
+    std::size_t createBatch(std::size_t n, FigureStore &sink) override;
+
+    std::size_t getFigureCount() const;
+};
+
+#endif // FIGURES_BINARYFIGUREFACTORY_HPP
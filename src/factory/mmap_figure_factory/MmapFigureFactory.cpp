@@ -0,0 +1,66 @@
+#include "MmapFigureFactory.hpp"
+
+#include "../../store/figure_arena/FigureArena.hpp"
+#include "../../store/figure_store/FigureStore.hpp"
+#include "../../util/figure_reader/FigureReader.hpp"
+
+MmapFigureFactory::MmapFigureFactory(const std::string &filename, const bool lenient)
+    : file(filename), tokenizer(file.view())
+{
+    if (lenient)
+    {
+        report.emplace();
+    }
+}
+
+template <typename Consumer> bool MmapFigureFactory::readOne(Consumer &&consumer)
+{
+    return report.has_value() ? FigureReader::readLenient(tokenizer, 1, *report, consumer) == 1
+                              : FigureReader::readWith(tokenizer, consumer);
+}
+
+std::unique_ptr<Figure> MmapFigureFactory::create()
+{
+    std::unique_ptr<Figure> figure;
+
+    readOne([&figure]<typename T>(const T &value) { figure = std::make_unique<T>(value); });
+
+    return figure;
+}
+
+Figure *MmapFigureFactory::createIn(FigureArena &arena)
+{
+    Figure *figure = nullptr;
+
+    readOne([&figure, &arena]<typename T>(const T &value) { figure = arena.make<T>(value); });
+
+    return figure;
+}
+
+std::size_t MmapFigureFactory::createBatch(const std::size_t n, FigureStore &sink)
+{
+    const auto add = [&sink](const auto &figure) { sink.add(figure); };
+
+    if (report.has_value())
+    {
+        return FigureReader::readLenient(tokenizer, n, *report, add);
+    }
+
+    std::size_t created = 0;
+    while (created < n && FigureReader::readWith(tokenizer, add))
+    {
+        created++;
+    }
+
+    return created;
+}
+
+const IngestReport *MmapFigureFactory::getIngestReport() const
+{
+    return report.has_value() ? &*report : nullptr;
+}
+
+std::size_t MmapFigureFactory::getBytesRead() const
+{
+    return tokenizer.getPosition();
+}
@@ -0,0 +1,33 @@
+#ifndef FIGURES_MMAPFIGUREFACTORY_HPP
+#define FIGURES_MMAPFIGUREFACTORY_HPP
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "../../util/mapped_file/MappedFile.hpp"
+#include "../../util/view_tokenizer/ViewTokenizer.hpp"
+#include "../../util/ingest_report/IngestReport.hpp"
+#include "../FigureFactory.hpp"
+
+class MmapFigureFactory final : public FigureFactory
+{
+  private:
+    MappedFile file;
+    ViewTokenizer tokenizer;
+    std::optional<IngestReport> report;
+
+    template <typename Consumer> bool readOne(Consumer &&consumer);
+
+  public:
+    explicit MmapFigureFactory(const std::string &filename, bool lenient = false);
+
+    std::unique_ptr<Figure> create() override;
+    Figure *createIn(FigureArena &arena) override;
+    std::size_t createBatch(std::size_t n, FigureStore &sink) override;
+    const IngestReport *getIngestReport() const override;
+
+    std::size_t getBytesRead() const;
+};
+
+#endif // FIGURES_MMAPFIGUREFACTORY_HPP
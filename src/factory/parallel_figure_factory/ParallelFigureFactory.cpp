@@ -0,0 +1,207 @@
+#include "ParallelFigureFactory.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <thread>
+
+#include "../../util/figure_reader/FigureReader.hpp"
+#include "../../util/string_to_figure/StringToFigure.hpp"
+#include "../../util/view_tokenizer/ViewTokenizer.hpp"
+
+ParallelFigureFactory::ParallelFigureFactory(const std::string &filename, const unsigned threads)
+    : file(filename), threads(threads)
+{
+    if (threads == 0)
+    {
+        throw std::invalid_argument("Number of threads must be greater than 0");
+    }
+}
+
+std::size_t ParallelFigureFactory::findRecordStart(const std::string_view text, std::size_t offset)
+{
+    const auto isSpace = [&text](const std::size_t i) { return std::isspace(static_cast<unsigned char>(text[i])); };
+
+    if (offset > 0 && offset < text.size() && !isSpace(offset - 1))
+    {
+        while (offset < text.size() && !isSpace(offset))
+        {
+            offset++;
+        }
+    }
+
+    // Numbers never spell a figure name, so the first name token after the offset starts a record
+    while (offset < text.size())
+    {
+        while (offset < text.size() && isSpace(offset))
+        {
+            offset++;
+        }
+
+        const std::size_t tokenStart = offset;
+        while (offset < text.size() && !isSpace(offset))
+        {
+            offset++;
+        }
+
+        if (StringToFigure::isFigureName(text.substr(tokenStart, offset - tokenStart)))
+        {
+            return tokenStart;
+        }
+    }
+
+    return text.size();
+}
+
+void ParallelFigureFactory::parseChunk(Chunk &chunk)
+{
+    ViewTokenizer tokenizer(chunk.text);
+    const auto add = [&chunk](const auto &figure) { chunk.figures.add(figure); };
+
+    try
+    {
+        while (FigureReader::readWith(tokenizer, add))
+        {
+        }
+    } catch (const std::exception &e)
+    {
+        chunk.error = e.what();
+    }
+}
+
+std::vector<std::string_view> ParallelFigureFactory::split() const
+{
+    const std::string_view text = file.view();
+
+    std::vector<std::size_t> starts = {0};
+    for (unsigned i = 1; i < threads; i++)
+    {
+        const std::size_t offset = text.size() / threads * i;
+        starts.push_back(std::max(starts.back(), findRecordStart(text, offset)));
+    }
+    starts.push_back(text.size());
+
+    std::vector<std::string_view> chunks;
+    for (unsigned i = 0; i < threads; i++)
+    {
+        chunks.push_back(text.substr(starts[i], starts[i + 1] - starts[i]));
+    }
+    return chunks;
+}
+
+void ParallelFigureFactory::load()
+{
+    const std::vector<std::string_view> texts = split();
+    std::vector<Chunk> chunks(texts.size());
+
+    std::vector<std::thread> workers;
+    for (std::size_t i = 0; i < chunks.size(); i++)
+    {
+        chunks[i].text = texts[i];
+        workers.emplace_back(parseChunk, std::ref(chunks[i]));
+    }
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    std::size_t figureCount = 0;
+    for (Chunk &chunk : chunks)
+    {
+        if (chunk.error.has_value())
+        {
+            // A record may straddle the boundary of a failing chunk, so the rest of the file is re-read serially
+            // to report exactly the error and index a serial read would
+            const std::string_view text = file.view();
+            Chunk rest;
+            rest.text = text.substr(static_cast<std::size_t>(chunk.text.data() - text.data()));
+            parseChunk(rest);
+
+            figureCount += rest.figures.size();
+            parsed.push_back(std::move(rest.figures));
+            if (rest.error.has_value())
+            {
+                error = "Figure #" + std::to_string(figureCount) + ": " + *rest.error;
+            }
+            break;
+        }
+
+        figureCount += chunk.figures.size();
+        parsed.push_back(std::move(chunk.figures));
+    }
+}
+
+void ParallelFigureFactory::ensureLoaded()
+{
+    if (!loaded)
+    {
+        load();
+        loaded = true;
+    }
+}
+
+void ParallelFigureFactory::skipExhausted()
+{
+    while (current < parsed.size() && next == parsed[current].size())
+    {
+        parsed[current] = FigureStore();
+        current++;
+        next = 0;
+    }
+}
+
+std::unique_ptr<Figure> ParallelFigureFactory::create()
+{
+    ensureLoaded();
+    skipExhausted();
+
+    if (current < parsed.size())
+    {
+        return parsed[current].at(next++);
+    }
+
+    if (error.has_value())
+    {
+        throw std::runtime_error(*error);
+    }
+
+    return nullptr;
+}
+
+std::size_t ParallelFigureFactory::createBatch(const std::size_t n, FigureStore &sink)
+{
+    ensureLoaded();
+
+    std::size_t created = 0;
+    for (skipExhausted(); created < n && current < parsed.size(); skipExhausted())
+    {
+        FigureStore &chunk = parsed[current];
+        const std::size_t count = std::min(n - created, chunk.size() - next);
+
+        // A whole chunk going into an empty sink is moved there, so no figure is held twice
+        if (next == 0 && count == chunk.size() && sink.slotCount() == 0)
+        {
+            sink = std::move(chunk);
+            chunk = FigureStore();
+            current++;
+        }
+        else
+        {
+            sink.append(chunk, next, count);
+            next += count;
+        }
+        created += count;
+    }
+
+    if (created < n && error.has_value())
+    {
+        throw std::runtime_error(*error);
+    }
+
+    return created;
+}
+
+unsigned ParallelFigureFactory::getThreads() const
+{
+    return threads;
+}
@@ -0,0 +1,51 @@
+#ifndef FIGURES_PARALLELFIGUREFACTORY_HPP
+#define FIGURES_PARALLELFIGUREFACTORY_HPP
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../../store/figure_store/FigureStore.hpp"
+#include "../../util/mapped_file/MappedFile.hpp"
+#include "../FigureFactory.hpp"
+
+class ParallelFigureFactory final : public FigureFactory
+{
+  private:
+    struct Chunk
+    {
+        std::string_view text;
+        FigureStore figures;
+        std::optional<std::string> error;
+    };
+
+    MappedFile file;
+    const unsigned threads;
+
+    bool loaded = false;
+    // The figures of each chunk in file order, each released once it has been handed out
+    std::vector<FigureStore> parsed;
+    std::optional<std::string> error;
+    std::size_t current = 0;
+    std::size_t next = 0;
+
+    static std::size_t findRecordStart(std::string_view text, std::size_t offset);
+    static void parseChunk(Chunk &chunk);
+
+    std::vector<std::string_view> split() const;
+    void load();
+    void ensureLoaded();
+    void skipExhausted();
+
+  public:
+    ParallelFigureFactory(const std::string &filename, unsigned threads);
+
+    std::unique_ptr<Figure> create() override;
+    std::size_t createBatch(std::size_t n, FigureStore &sink) override;
+
+    unsigned getThreads() const;
+};
+
+#endif // FIGURES_PARALLELFIGUREFACTORY_HPP
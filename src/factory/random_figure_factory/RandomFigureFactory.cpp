@@ -1,63 +1,166 @@
 #include "RandomFigureFactory.hpp"
 
-#include <ctime>
+#include <algorithm>
 #include <cmath>
-
+#include <limits>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "../../store/figure_arena/FigureArena.hpp"
+#include "../../store/figure_store/FigureStore.hpp"
+#include "../../util/figure_registry/FigureRegistry.hpp"
 #include "../../util/figure_util/FigureUtil.hpp"
+#include "../../util/parallel_blocks/ParallelBlocks.hpp"
+#include "../../util/philox/Philox.hpp"
 
-const unsigned RandomFigureFactory::seed = std::time(nullptr);
+namespace
+{
+double uniform(const double u, const double minValue, const double maxValue)
+{
+    return minValue + u * (maxValue - minValue);
+}
+} // namespace
 
-std::unique_ptr<Triangle> RandomFigureFactory::generateTriangle()
+template <> Triangle RandomFigureFactory::generateFigure<Triangle>(const std::span<const double, 3> u)
 {
     constexpr double maxValue = std::numeric_limits<double>::max() / 3;
     constexpr double minValue = std::numeric_limits<double>::min();
 
-    std::uniform_real_distribution triangleDist(minValue, maxValue);
-
-    const double a = triangleDist(rng);
-    const double b = triangleDist(rng);
+    const double a = uniform(u[0], minValue, maxValue);
+    const double b = uniform(u[1], minValue, maxValue);
+    const double c = uniform(u[2], std::abs(a - b) + minValue, std::min(maxValue, a + b - minValue));
 
-    std::uniform_real_distribution thirdSideDist(std::abs(a - b) + minValue, std::min(maxValue, a + b - minValue));
-    const double c = thirdSideDist(rng);
+    // Rounding can land c on the edge of the valid range, max(a, b) is always a valid third side
+    if (!Triangle::tryCreate(a, b, c).has_value())
+    {
+        return {a, b, std::max(a, b)};
+    }
 
-    return std::make_unique<Triangle>(a, b, c);
+    return {a, b, c};
 }
 
-std::unique_ptr<Circle> RandomFigureFactory::generateCircle()
+template <> Circle RandomFigureFactory::generateFigure<Circle>(const std::span<const double, 1> u)
 {
     constexpr double maxValue = std::numeric_limits<double>::max() / (M_PI * 2);
     constexpr double minValue = std::numeric_limits<double>::min();
 
-    std::uniform_real_distribution<double> circDist(minValue, maxValue);
-
-    return std::make_unique<Circle>(circDist(rng));
+    return Circle(uniform(u[0], minValue, maxValue));
 }
 
-std::unique_ptr<Rectangle> RandomFigureFactory::generateRectangle()
+template <> Rectangle RandomFigureFactory::generateFigure<Rectangle>(const std::span<const double, 2> u)
 {
     constexpr double maxValue = std::numeric_limits<double>::max() / 4;
     constexpr double minValue = std::numeric_limits<double>::min();
 
-    std::uniform_real_distribution<double> rectDist(minValue, maxValue);
+    return {uniform(u[0], minValue, maxValue), uniform(u[1], minValue, maxValue)};
+}
 
-    return std::make_unique<Rectangle>(rectDist(rng), rectDist(rng));
+// Figure #index depends only on (seed, index): the first Philox block picks the type and the first parameter, a
+// second block is drawn only for figures with more parameters
+template <typename Consumer>
+void RandomFigureFactory::generate(const std::uint64_t seed, const std::uint64_t index, Consumer &&consumer)
+{
+    const std::array<std::uint64_t, 2> first = Philox::generate64(index, 0, seed);
+    const auto type = static_cast<FigureUtil::FigureType>((first[0] >> 32) * FigureUtil::FIGURE_NUM >> 32);
+
+    FigureRegistry::visit(type, [&]<typename T>() {
+        std::array<double, T::PARAMS> u{};
+        u[0] = Philox::toUnitDouble(first[1]);
+
+        if constexpr (T::PARAMS > 1)
+        {
+            const std::array<std::uint64_t, 2> second = Philox::generate64(index, 1, seed);
+            for (unsigned i = 1; i < T::PARAMS; i++)
+            {
+                u[i] = Philox::toUnitDouble(second[i - 1]);
+            }
+        }
+
+        consumer(generateFigure<T>(u));
+    });
 }
 
-RandomFigureFactory::RandomFigureFactory() : rng(RandomFigureFactory::seed)
+void RandomFigureFactory::generateRange(const std::uint64_t seed, const std::uint64_t first, const std::size_t count,
+                                        FigureStore &sink)
+{
+    sink.reserve(sink.size() + count);
+
+    for (std::uint64_t index = first; index < first + count; index++)
+    {
+        generate(seed, index, [&sink](const auto &figure) { sink.add(figure); });
+    }
+}
+
+RandomFigureFactory::RandomFigureFactory() : RandomFigureFactory(makeSeed())
 {
 }
 
+RandomFigureFactory::RandomFigureFactory(const std::uint64_t seed, const unsigned threads)
+    : seed(seed), threads(threads)
+{
+    if (threads == 0)
+    {
+        throw std::invalid_argument("Number of threads must be greater than 0");
+    }
+}
+
 std::unique_ptr<Figure> RandomFigureFactory::create()
 {
-    switch (FigureUtil::getRandomFigureType(rng))
+    std::unique_ptr<Figure> figure;
+
+    generate(seed, next++, [&figure]<typename T>(const T &value) { figure = std::make_unique<T>(value); });
+
+    return figure;
+}
+
+Figure *RandomFigureFactory::createIn(FigureArena &arena)
+{
+    Figure *figure = nullptr;
+
+    generate(seed, next++, [&figure, &arena]<typename T>(const T &value) { figure = arena.make<T>(value); });
+
+    return figure;
+}
+
+std::size_t RandomFigureFactory::createBatch(const std::size_t n, FigureStore &sink)
+{
+    const std::uint64_t first = next;
+    next += n;
+
+    if (threads == 1 || n < PARALLEL_THRESHOLD)
     {
-    case FigureUtil::TRIANGLE:
-        return generateTriangle();
-    case FigureUtil::CIRCLE:
-        return generateCircle();
-    case FigureUtil::RECTANGLE:
-        return generateRectangle();
-    default:
-        return nullptr;
+        generateRange(seed, first, n, sink);
+        return n;
     }
+
+    std::vector<FigureStore> chunks(threads);
+    ParallelBlocks::forEach(threads, n, [&](const unsigned t, const std::size_t begin, const std::size_t end) {
+        generateRange(seed, first + begin, end - begin, chunks[t]);
+    });
+
+    sink.reserve(sink.size() + n);
+    for (FigureStore &chunk : chunks)
+    {
+        sink.append(chunk);
+        chunk = FigureStore();
+    }
+
+    return n;
+}
+
+std::uint64_t RandomFigureFactory::makeSeed()
+{
+    std::random_device device;
+    return static_cast<std::uint64_t>(device()) << 32 | device();
+}
+
+std::uint64_t RandomFigureFactory::getSeed() const
+{
+    return seed;
+}
+
+unsigned RandomFigureFactory::getThreads() const
+{
+    return threads;
 }
@@ -1,8 +1,9 @@
 #ifndef FIGURES_RANDOMFIGUREFACTORY_HPP
 #define FIGURES_RANDOMFIGUREFACTORY_HPP
 
-#include <random>
+#include <cstdint>
 #include <memory>
+#include <span>
 
 #include "../../figure/circle/Circle.hpp"
 #include "../../figure/rectangle/Rectangle.hpp"
@@ -12,17 +13,31 @@
 class RandomFigureFactory final : public FigureFactory
 {
   private:
-    static const unsigned seed;
-    std::mt19937_64 rng;
+    static constexpr std::size_t PARALLEL_THRESHOLD = 1 << 16;
 
-    std::unique_ptr<Triangle> generateTriangle();
-    std::unique_ptr<Circle> generateCircle();
-    std::unique_ptr<Rectangle> generateRectangle();
+    const std::uint64_t seed;
+    const unsigned threads;
+    std::uint64_t next = 0;
+
+    // Maps T::PARAMS uniform draws in [0, 1) to a valid figure, specialised for every registered figure
+    template <typename T> static T generateFigure(std::span<const double, T::PARAMS> u);
+
+    template <typename Consumer> static void generate(std::uint64_t seed, std::uint64_t index, Consumer &&consumer);
+
+    static void generateRange(std::uint64_t seed, std::uint64_t first, std::size_t count, FigureStore &sink);
 
   public:
     RandomFigureFactory();
+    explicit RandomFigureFactory(std::uint64_t seed, unsigned threads = 1);
 
     std::unique_ptr<Figure> create() override;
+    Figure *createIn(FigureArena &arena) override;
+    std::size_t createBatch(std::size_t n, FigureStore &sink) override;
+
+    static std::uint64_t makeSeed();
+
+    std::uint64_t getSeed() const;
+    unsigned getThreads() const;
 };
 
-#endif // FIGURES_RANDO IGUREFACTORY_HPP
+#endif // FIGURES_RANDOMFIGUREFACTORY_HPP
@@ -1,46 +1,83 @@
 #include "StreamFigureFactory.hpp"
 
-#include <algorithm>
 #include <iostream>
-#include <stdexcept>
-#include <sstream>
 
-#include "../../util/figure_util/FigureUtil.hpp"
-#include "../../util/string_to_figure/StringToFigure.hpp"
+#include "../../store/figure_arena/FigureArena.hpp"
+#include "../../store/figure_store/FigureStore.hpp"
+#include "../../util/figure_reader/FigureReader.hpp"
 
-StreamFigureFactory::StreamFigureFactory(std::unique_ptr<std::istream> is) : is(std::move(is))
+StreamFigureFactory::StreamFigureFactory(std::unique_ptr<std::istream> is, const bool lenient)
+    : is(std::move(is)), tokenizer(this->is == nullptr ? std::cin : *this->is, this->is != nullptr)
 {
+    if (lenient)
+    {
+        report.emplace();
+    }
 }
 
-std::unique_ptr<Figure> StreamFigureFactory::create()
+template <typename Consumer> bool StreamFigureFactory::readOne(Consumer &&consumer)
 {
-    std::istream &input = (is == nullptr) ? std::cin : *is;
-    std::stringstream sstream;
-    std::string figure;
+    const bool created = report.has_value() ? FigureReader::readLenient(tokenizer, 1, *report, consumer) == 1
+                                            : FigureReader::readWith(tokenizer, consumer);
 
-    if (!(input >> figure))
+    if (created)
     {
-        return nullptr;
+        figuresRead++;
     }
 
-    sstream << figure;
+    return created;
+}
+
+std::unique_ptr<Figure> StreamFigureFactory::create()
+{
+    std::unique_ptr<Figure> figure;
+
+    readOne([&figure]<typename T>(const T &value) { figure = std::make_unique<T>(value); });
+
+    return figure;
+}
 
-    std::ranges::transform(figure, figure.begin(), [](const unsigned char c) { return std::tolower(c); });
+Figure *StreamFigureFactory::createIn(FigureArena &arena)
+{
+    Figure *figure = nullptr;
+
+    readOne([&figure, &arena]<typename T>(const T &value) { figure = arena.make<T>(value); });
+
+    return figure;
+}
 
-    const FigureUtil::FigureType type = FigureUtil::strToFigure(figure);
+std::size_t StreamFigureFactory::createBatch(const std::size_t n, FigureStore &sink)
+{
+    const auto add = [&sink](const auto &figure) { sink.add(figure); };
 
-    const unsigned paramN = FigureUtil::getFigureParams(type);
-    for (unsigned i = 0; i < paramN; i++)
+    std::size_t created = 0;
+    if (report.has_value())
+    {
+        created = FigureReader::readLenient(tokenizer, n, *report, add);
+    }
+    else
     {
-        std::string value;
-        if (!(input >> value))
+        while (created < n && FigureReader::readWith(tokenizer, add))
         {
-            throw std::runtime_error("Cannot read from input stream!");
+            created++;
         }
-
-        sstream << ' ';
-        sstream << value;
     }
 
-    return StringToFigure::createFigure(sstream.str());
-}
\ No newline at end of file
+    figuresRead += created;
+    return created;
+}
+
+const IngestReport *StreamFigureFactory::getIngestReport() const
+{
+    return report.has_value() ? &*report : nullptr;
+}
+
+std::size_t StreamFigureFactory::getBytesRead() const
+{
+    return tokenizer.getBytesRead();
+}
+
+std::size_t StreamFigureFactory::getFiguresRead() const
+{
+    return figuresRead;
+}
@@ -3,18 +3,32 @@
 
 #include <istream>
 #include <memory>
+#include <optional>
 
+#include "../../util/stream_tokenizer/StreamTokenizer.hpp"
+#include "../../util/ingest_report/IngestReport.hpp"
 #include "../FigureFactory.hpp"
 
 class StreamFigureFactory final : public FigureFactory
 {
   private:
     std::unique_ptr<std::istream> is;
+    StreamTokenizer tokenizer;
+    std::size_t figuresRead = 0;
+    std::optional<IngestReport> report;
+
+    template <typename Consumer> bool readOne(Consumer &&consumer);
 
   public:
-    explicit StreamFigureFactory(std::unique_ptr<std::istream> is);
+    explicit StreamFigureFactory(std::unique_ptr<std::istream> is, bool lenient = false);
 
     std::unique_ptr<Figure> create() override;
+    Figure *createIn(FigureArena &arena) override;
+    std::size_t createBatch(std::size_t n, FigureStore &sink) override;
+    const IngestReport *getIngestReport() const override;
+
+    std::size_t getBytesRead() const;
+    std::size_t getFiguresRead() const;
 };
 
 #endif // FIGURES_STREAMFIGUREFACTORY_HPP
@@ -1,7 +1,43 @@
 #include "Figure.hpp"
 
+#include <charconv>
+#include <cstring>
+
+namespace
+{
+constexpr std::size_t MAX_NUMBER_SIZE = 24;
+} // namespace
+
+char *Figure::appendText(char *buffer, const std::string_view text)
+{
+    std::memcpy(buffer, text.data(), text.size());
+    return buffer + text.size();
+}
+
+char *Figure::appendNumber(char *buffer, const double value)
+{
+    return std::to_chars(buffer, buffer + MAX_NUMBER_SIZE, value).ptr;
+}
+
+void Figure::formatTo(std::string &out) const
+{
+    const std::size_t size = out.size();
+    out.resize(size + MAX_FORMATTED_SIZE);
+    out.resize(formatTo(out.data() + size) - out.data());
+}
+
+std::string Figure::toString() const
+{
+    std::string out;
+    formatTo(out);
+    return out;
+}
+
 std::ostream &operator<<(std::ostream &os, const Figure &figure)
 {
-    os << figure.toString() << '\n';
-    return os;
+    char buffer[Figure::MAX_FORMATTED_SIZE + 1];
+    char *end = figure.formatTo(buffer);
+    *end++ = '\n';
+
+    return os.write(buffer, end - buffer);
 }
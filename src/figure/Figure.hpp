@@ -1,18 +1,41 @@
 #ifndef FIGURES_FIGURE_HPP
 #define FIGURES_FIGURE_HPP
 
+#include <cstddef>
+#include <memory_resource>
 #include <ostream>
+#include <string>
+#include <string_view>
 
 #include "../util/Clonable.hpp"
 #include "../util/StringConvertible.hpp"
+#include "../util/figure_util/FigureUtil.hpp"
 
 class Figure : public Clonable, public StringConvertible
 {
   public:
+    static constexpr std::size_t MAX_FORMATTED_SIZE = 128;
+
+    // Building blocks of formatTo, shared with other figure representations so they print the same text
+    static char *appendText(char *buffer, std::string_view text);
+    static char *appendNumber(char *buffer, double value);
+
     virtual double perimeter() const = 0;
 
+    virtual FigureUtil::FigureType getType() const = 0;
+
     Figure *clone() const override = 0;
 
+    // Allocates the copy from resource, which owns its memory; the copy must not be deleted
+    virtual Figure *clone(std::pmr::memory_resource &resource) const = 0;
+
+    // Writes at most MAX_FORMATTED_SIZE characters and returns the end of the written text
+    virtual char *formatTo(char *buffer) const = 0;
+
+    void formatTo(std::string &out) const;
+
+    std::string toString() const override;
+
     ~Figure() override = default;
 
     friend std::ostream &operator<<(std::ostream &os, const Figure &figure);
@@ -1,25 +1,44 @@
 #include "Circle.hpp"
 
 #include <cmath>
-#include <sstream>
 #include <stdexcept>
 
-void Circle::validateRadius(const double radius)
+std::optional<ParseError::Code> Circle::validate(const double radius)
 {
     if (radius <= 0 || !std::isfinite(radius))
     {
-        throw std::invalid_argument("Radius must be a finite positive value");
+        return ParseError::INVALID_RADIUS;
     }
+
+    if (!std::isfinite(2 * M_PI * radius))
+    {
+        return ParseError::INVALID_PERIMETER;
+    }
+
+    return std::nullopt;
 }
 
 Circle::Circle(const double radius) : radius(radius)
 {
-    validateRadius(radius);
+    if (const std::optional<ParseError::Code> error = validate(radius))
+    {
+        throw std::invalid_argument(ParseError::describe(*error));
+    }
+}
 
-    if (!std::isfinite(Circle::perimeter()))
+std::expected<Circle, ParseError::Code> Circle::tryCreate(const double radius)
+{
+    if (const std::optional<ParseError::Code> error = validate(radius))
     {
-        throw std::invalid_argument("Perimeter must be a finite positive value");
+        return std::unexpected(*error);
     }
+
+    return Circle(radius);
+}
+
+double Circle::getRadius() const
+{
+    return radius;
 }
 
 double Circle::perimeter() const
@@ -27,14 +46,24 @@ double Circle::perimeter() const
     return 2 * M_PI * radius;
 }
 
-std::string Circle::toString() const
+FigureUtil::FigureType Circle::getType() const
 {
-    std::stringstream sstream;
-    sstream << "Circle " << radius;
-    return sstream.str();
+    return FigureUtil::CIRCLE;
+}
+
+char *Circle::formatTo(char *buffer) const
+{
+    buffer = appendText(buffer, DISPLAY_NAME);
+    *buffer++ = ' ';
+    return appendNumber(buffer, radius);
 }
 
 Circle *Circle::clone() const
 {
     return new Circle(radius);
 }
+
+Circle *Circle::clone(std::pmr::memory_resource &resource) const
+{
+    return std::pmr::polymorphic_allocator<>(&resource).new_object<Circle>(radius);
+}
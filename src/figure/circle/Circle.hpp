@@ -1,25 +1,42 @@
 #ifndef FIGURES_CIRCLE_HPP
 #define FIGURES_CIRCLE_HPP
 
+#include <expected>
+#include <optional>
 #include <string>
+#include <string_view>
 
 #include "../Figure.hpp"
+#include "../../util/parse_error/ParseError.hpp"
 
 class Circle final : public Figure
 {
   private:
     const double radius;
 
-    static void validateRadius(double radius);
+    static std::optional<ParseError::Code> validate(double radius);
 
   public:
+    static constexpr FigureUtil::FigureType TYPE = FigureUtil::CIRCLE;
+    static constexpr std::string_view NAME = "circle";
+    static constexpr std::string_view DISPLAY_NAME = "Circle";
+    static constexpr unsigned PARAMS = 1;
+
     explicit Circle(double radius);
 
+    static std::expected<Circle, ParseError::Code> tryCreate(double radius);
+
+    double getRadius() const;
+
     double perimeter() const override;
 
-    std::string toString() const override;
+    FigureUtil::FigureType getType() const override;
+
+    using Figure::formatTo;
+    char *formatTo(char *buffer) const override;
 
     Circle *clone() const override;
+    Circle *clone(std::pmr::memory_resource &resource) const override;
 };
 
 #endif // FIGURES_CIRCLE_HPP
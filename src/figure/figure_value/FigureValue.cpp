@@ -0,0 +1,124 @@
+#include "FigureValue.hpp"
+
+#include <array>
+#include <cmath>
+
+#include "../../util/figure_hash/FigureHash.hpp"
+#include "../../util/figure_registry/FigureRegistry.hpp"
+
+namespace
+{
+std::array<double, 3> paramsOf(const FigureValue::TriangleData &triangle)
+{
+    return {triangle.a, triangle.b, triangle.c};
+}
+
+std::array<double, 1> paramsOf(const FigureValue::CircleData &circle)
+{
+    return {circle.radius};
+}
+
+std::array<double, 2> paramsOf(const FigureValue::RectangleData &rectangle)
+{
+    return {rectangle.width, rectangle.height};
+}
+
+std::unique_ptr<Figure> figureOf(const FigureValue::TriangleData &triangle)
+{
+    return std::make_unique<Triangle>(triangle.a, triangle.b, triangle.c);
+}
+
+std::unique_ptr<Figure> figureOf(const FigureValue::CircleData &circle)
+{
+    return std::make_unique<Circle>(circle.radius);
+}
+
+std::unique_ptr<Figure> figureOf(const FigureValue::RectangleData &rectangle)
+{
+    return std::make_unique<Rectangle>(rectangle.width, rectangle.height);
+}
+} // namespace
+
+FigureValue::FigureValue(const Triangle &triangle)
+    : data(TriangleData{triangle.getA(), triangle.getB(), triangle.getC()})
+{
+}
+
+FigureValue::FigureValue(const Circle &circle) : data(CircleData{circle.getRadius()})
+{
+}
+
+FigureValue::FigureValue(const Rectangle &rectangle) : data(RectangleData{rectangle.getWidth(), rectangle.getHeight()})
+{
+}
+
+FigureValue::FigureValue(const Figure &figure)
+    : data(FigureRegistry::visit(figure.getType(), [&figure]<typename T>() {
+          return FigureValue(static_cast<const T &>(figure)).data;
+      }))
+{
+}
+
+std::expected<FigureValue, ParseError::Code> FigureValue::tryCreate(const FigureUtil::FigureType type,
+                                                                    const std::span<const double> params)
+{
+    if (params.size() != FigureUtil::getFigureParams(type))
+    {
+        return std::unexpected(ParseError::WRONG_PARAMETER_COUNT);
+    }
+
+    return FigureRegistry::visit(type, [params]<typename T>() -> std::expected<FigureValue, ParseError::Code> {
+        const std::expected<T, ParseError::Code> figure = FigureRegistry::tryMake<T>(params);
+        if (!figure.has_value())
+        {
+            return std::unexpected(figure.error());
+        }
+
+        return FigureValue(*figure);
+    });
+}
+
+const FigureValue::Data &FigureValue::getData() const
+{
+    return data;
+}
+
+char *FigureValue::formatTo(char *buffer) const
+{
+    buffer = Figure::appendText(buffer, FigureRegistry::displayName(getType()));
+
+    return std::visit(
+        [buffer](const auto &figure) mutable {
+            for (const double param : paramsOf(figure))
+            {
+                *buffer++ = ' ';
+                buffer = Figure::appendNumber(buffer, param);
+            }
+            return buffer;
+        },
+        data);
+}
+
+void FigureValue::formatTo(std::string &out) const
+{
+    const std::size_t size = out.size();
+    out.resize(size + Figure::MAX_FORMATTED_SIZE);
+    out.resize(formatTo(out.data() + size) - out.data());
+}
+
+std::string FigureValue::toString() const
+{
+    std::string out;
+    formatTo(out);
+    return out;
+}
+
+std::uint64_t FigureValue::hash() const
+{
+    return std::visit([this](const auto &figure) { return FigureHash::hash(getType(), paramsOf(figure)); }, data);
+}
+
+std::unique_ptr<Figure> FigureValue::toFigure() const
+{
+    return std::visit([](const auto &figure) { return figureOf(figure); }, data);
+}
@@ -0,0 +1,101 @@
+#ifndef FIGURES_FIGUREVALUE_HPP
+#define FIGURES_FIGUREVALUE_HPP
+
+#include <cstdint>
+#include <expected>
+#include <memory>
+#include <span>
+#include <string>
+#include <variant>
+
+#include "../Figure.hpp"
+#include "../circle/Circle.hpp"
+#include "../rectangle/Rectangle.hpp"
+#include "../triangle/Triangle.hpp"
+#include "../../util/parse_error/ParseError.hpp"
+
+// A figure held by value, dispatched with std::visit instead of virtual calls so vectors of them are contiguous and
+// perimeter() can be inlined into the caller. Values are only made from valid figures or checked parameters
+class FigureValue
+{
+  public:
+    struct TriangleData
+    {
+        double a;
+        double b;
+        double c;
+
+        bool operator==(const TriangleData &) const = default;
+    };
+
+    struct CircleData
+    {
+        double radius;
+
+        bool operator==(const CircleData &) const = default;
+    };
+
+    struct RectangleData
+    {
+        double width;
+        double height;
+
+        bool operator==(const RectangleData &) const = default;
+    };
+
+    // Alternatives are in FigureType order, so the index of the alternative is the figure type
+    using Data = std::variant<TriangleData, CircleData, RectangleData>;
+
+  private:
+    Data data;
+
+    static double perimeterOf(const TriangleData &triangle)
+    {
+        return triangle.a + triangle.b + triangle.c;
+    }
+
+    static double perimeterOf(const CircleData &circle)
+    {
+        return 2 * M_PI * circle.radius;
+    }
+
+    static double perimeterOf(const RectangleData &rectangle)
+    {
+        return 2 * rectangle.width + 2 * rectangle.height;
+    }
+
+  public:
+    explicit FigureValue(const Triangle &triangle);
+    explicit FigureValue(const Circle &circle);
+    explicit FigureValue(const Rectangle &rectangle);
+    explicit FigureValue(const Figure &figure);
+
+    static std::expected<FigureValue, ParseError::Code> tryCreate(FigureUtil::FigureType type,
+                                                                  std::span<const double> params);
+
+    FigureUtil::FigureType getType() const
+    {
+        return static_cast<FigureUtil::FigureType>(data.index());
+    }
+
+    const Data &getData() const;
+
+    double perimeter() const
+    {
+        return std::visit([](const auto &figure) { return perimeterOf(figure); }, data);
+    }
+
+    // Writes at most Figure::MAX_FORMATTED_SIZE characters, the same text the Figure would
+    char *formatTo(char *buffer) const;
+    void formatTo(std::string &out) const;
+    std::string toString() const;
+
+    // FigureHash::hash of the figure
+    std::uint64_t hash() const;
+
+    std::unique_ptr<Figure> toFigure() const;
+
+    bool operator==(const FigureValue &) const = default;
+};
+
+#endif // FIGURES_FIGUREVALUE_HPP
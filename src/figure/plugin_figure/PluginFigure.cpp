@@ -0,0 +1,89 @@
+#include "PluginFigure.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+static_assert(FIGURES_PLUGIN_FORMAT_SIZE <= Figure::MAX_FORMATTED_SIZE);
+
+std::optional<ParseError::Code> PluginFigure::validate(const PluginRegistry &registry, const PluginRegistry::TypeId id,
+                                                       const std::span<const double> params)
+{
+    if (params.size() != registry.params(id))
+    {
+        return ParseError::WRONG_PARAMETER_COUNT;
+    }
+
+    if (!registry.isValid(id, params))
+    {
+        return ParseError::INVALID_PLUGIN_FIGURE;
+    }
+
+    return std::nullopt;
+}
+
+PluginFigure::PluginFigure(const PluginRegistry &registry, const PluginRegistry::TypeId id,
+                           const std::span<const double> params)
+    : registry(&registry), id(id), paramN(static_cast<unsigned>(params.size()))
+{
+    registry.checkParamCount(id, params.size());
+
+    if (const std::optional<ParseError::Code> error = validate(registry, id, params))
+    {
+        throw std::invalid_argument(ParseError::describe(*error));
+    }
+
+    std::ranges::copy(params, this->params.begin());
+}
+
+std::expected<PluginFigure, ParseError::Code> PluginFigure::tryCreate(const PluginRegistry &registry,
+                                                                      const PluginRegistry::TypeId id,
+                                                                      const std::span<const double> params)
+{
+    if (const std::optional<ParseError::Code> error = validate(registry, id, params))
+    {
+        return std::unexpected(*error);
+    }
+
+    return PluginFigure(registry, id, params);
+}
+
+const PluginRegistry &PluginFigure::getRegistry() const
+{
+    return *registry;
+}
+
+PluginRegistry::TypeId PluginFigure::getTypeId() const
+{
+    return id;
+}
+
+std::span<const double> PluginFigure::getParams() const
+{
+    return std::span(params).first(paramN);
+}
+
+double PluginFigure::perimeter() const
+{
+    return registry->perimeter(id, getParams());
+}
+
+FigureUtil::FigureType PluginFigure::getType() const
+{
+    throw std::logic_error("Figure type '" + std::string(registry->name(id)) + "' comes from a plugin");
+}
+
+char *PluginFigure::formatTo(char *buffer) const
+{
+    return registry->formatTo(id, getParams(), buffer);
+}
+
+PluginFigure *PluginFigure::clone() const
+{
+    return new PluginFigure(*this);
+}
+
+PluginFigure *PluginFigure::clone(std::pmr::memory_resource &resource) const
+{
+    return std::pmr::polymorphic_allocator<>(&resource).new_object<PluginFigure>(*this);
+}
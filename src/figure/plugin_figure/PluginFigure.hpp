@@ -0,0 +1,50 @@
+#ifndef FIGURES_PLUGINFIGURE_HPP
+#define FIGURES_PLUGINFIGURE_HPP
+
+#include <array>
+#include <expected>
+#include <optional>
+#include <span>
+
+#include "../Figure.hpp"
+#include "../../util/parse_error/ParseError.hpp"
+#include "../../util/plugin_registry/PluginRegistry.hpp"
+
+// A figure of a type added by a plugin, measured and formatted by the plugin through the registry that loaded it,
+// which must outlive the figure. Plugin types have no FigureType, so getType() throws std::logic_error
+class PluginFigure final : public Figure
+{
+  private:
+    const PluginRegistry *registry;
+    PluginRegistry::TypeId id;
+    unsigned paramN;
+    std::array<double, FIGURES_PLUGIN_MAX_PARAMS> params{};
+
+    static std::optional<ParseError::Code> validate(const PluginRegistry &registry, PluginRegistry::TypeId id,
+                                                    std::span<const double> params);
+
+  public:
+    PluginFigure(const PluginRegistry &registry, PluginRegistry::TypeId id, std::span<const double> params);
+
+    static std::expected<PluginFigure, ParseError::Code> tryCreate(const PluginRegistry &registry,
+                                                                   PluginRegistry::TypeId id,
+                                                                   std::span<const double> params);
+
+    const PluginRegistry &getRegistry() const;
+
+    PluginRegistry::TypeId getTypeId() const;
+
+    std::span<const double> getParams() const;
+
+    double perimeter() const override;
+
+    FigureUtil::FigureType getType() const override;
+
+    using Figure::formatTo;
+    char *formatTo(char *buffer) const override;
+
+    PluginFigure *clone() const override;
+    PluginFigure *clone(std::pmr::memory_resource &resource) const override;
+};
+
+#endif // FIGURES_PLUGINFIGURE_HPP
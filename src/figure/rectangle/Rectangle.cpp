@@ -1,26 +1,54 @@
 #include "Rectangle.hpp"
 
 #include <cmath>
-#include <sstream>
 #include <stdexcept>
 
-void Rectangle::validateDimension(const double value, const std::string &name)
+std::optional<ParseError::Code> Rectangle::validate(const double width, const double height)
 {
-    if (value <= 0 || !std::isfinite(value))
+    if (width <= 0 || !std::isfinite(width))
     {
-        throw std::invalid_argument("'" + name + "' must be a finite positive value");
+        return ParseError::INVALID_WIDTH;
     }
+
+    if (height <= 0 || !std::isfinite(height))
+    {
+        return ParseError::INVALID_HEIGHT;
+    }
+
+    if (!std::isfinite(2 * width + 2 * height))
+    {
+        return ParseError::INVALID_PERIMETER;
+    }
+
+    return std::nullopt;
 }
 
 Rectangle::Rectangle(const double width, const double height) : width(width), height(height)
 {
-    validateDimension(width, "width");
-    validateDimension(height, "height");
+    if (const std::optional<ParseError::Code> error = validate(width, height))
+    {
+        throw std::invalid_argument(ParseError::describe(*error));
+    }
+}
 
-    if (!std::isfinite(Rectangle::perimeter()))
+std::expected<Rectangle, ParseError::Code> Rectangle::tryCreate(const double width, const double height)
+{
+    if (const std::optional<ParseError::Code> error = validate(width, height))
     {
-        throw std::invalid_argument("Perimeter must be a finite positive value");
+        return std::unexpected(*error);
     }
+
+    return Rectangle(width, height);
+}
+
+double Rectangle::getWidth() const
+{
+    return width;
+}
+
+double Rectangle::getHeight() const
+{
+    return height;
 }
 
 double Rectangle::perimeter() const
@@ -28,14 +56,26 @@ double Rectangle::perimeter() const
     return 2 * width + 2 * height;
 }
 
-std::string Rectangle::toString() const
+FigureUtil::FigureType Rectangle::getType() const
 {
-    std::stringstream sstream;
-    sstream << "Rectangle " << width << " " << height;
-    return sstream.str();
+    return FigureUtil::RECTANGLE;
+}
+
+char *Rectangle::formatTo(char *buffer) const
+{
+    buffer = appendText(buffer, DISPLAY_NAME);
+    *buffer++ = ' ';
+    buffer = appendNumber(buffer, width);
+    *buffer++ = ' ';
+    return appendNumber(buffer, height);
 }
 
 Rectangle *Rectangle::clone() const
 {
     return new Rectangle(width, height);
 }
+
+Rectangle *Rectangle::clone(std::pmr::memory_resource &resource) const
+{
+    return std::pmr::polymorphic_allocator<>(&resource).new_object<Rectangle>(width, height);
+}
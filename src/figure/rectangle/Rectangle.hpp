@@ -1,9 +1,13 @@
 #ifndef FIGURES_RECTANGLE_HPP
 #define FIGURES_RECTANGLE_HPP
 
+#include <expected>
+#include <optional>
 #include <string>
+#include <string_view>
 
 #include "../Figure.hpp"
+#include "../../util/parse_error/ParseError.hpp"
 
 class Rectangle final : public Figure
 {
@@ -11,16 +15,31 @@ class Rectangle final : public Figure
     const double width;
     const double height;
 
-    static void validateDimension(double value, const std::string &name);
+    static std::optional<ParseError::Code> validate(double width, double height);
 
   public:
+    static constexpr FigureUtil::FigureType TYPE = FigureUtil::RECTANGLE;
+    static constexpr std::string_view NAME = "rectangle";
+    static constexpr std::string_view DISPLAY_NAME = "Rectangle";
+    static constexpr unsigned PARAMS = 2;
+
     Rectangle(double width, double height);
 
+    static std::expected<Rectangle, ParseError::Code> tryCreate(double width, double height);
+
+    double getWidth() const;
+
+    double getHeight() const;
+
     double perimeter() const override;
 
-    std::string toString() const override;
+    FigureUtil::FigureType getType() const override;
+
+    using Figure::formatTo;
+    char *formatTo(char *buffer) const override;
 
     Rectangle *clone() const override;
+    Rectangle *clone(std::pmr::memory_resource &resource) const override;
 };
 
 #endif // FIGURES_RECTANGLE_HPP
@@ -0,0 +1,176 @@
+#ifndef FIGURES_SHAREDFIGURE_HPP
+#define FIGURES_SHAREDFIGURE_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "../Figure.hpp"
+#include "../plugin_figure/PluginFigure.hpp"
+#include "../../util/figure_registry/FigureRegistry.hpp"
+
+// Owner counts for BasicSharedFigure: a plain counter for handles that stay on one thread, and an atomic one for
+// handles that are copied or dropped on several threads
+class LocalRefCount
+{
+    std::size_t count = 1;
+
+  public:
+    void acquire()
+    {
+        count++;
+    }
+
+    // True when the last owner let go
+    bool release()
+    {
+        return --count == 0;
+    }
+
+    std::size_t get() const
+    {
+        return count;
+    }
+};
+
+class AtomicRefCount
+{
+    std::atomic<std::size_t> count = 1;
+
+  public:
+    void acquire()
+    {
+        count.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool release()
+    {
+        return count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+    }
+
+    std::size_t get() const
+    {
+        return count.load(std::memory_order_relaxed);
+    }
+};
+
+// A reference-counted handle to an immutable figure. Copying the handle is the O(1) way to clone a figure: the
+// copies share one payload, which is freed with the last of them. deepCopy() still gives a figure of its own
+// through Clonable.
+template <typename RefCount> class BasicSharedFigure
+{
+    struct Block
+    {
+        RefCount refs;
+
+        virtual ~Block() = default;
+    };
+
+    // The count and the figure share one allocation
+    template <typename T> struct Node final : Block
+    {
+        const T figure;
+
+        template <typename... Args> explicit Node(Args &&...args) : figure(std::forward<Args>(args)...)
+        {
+        }
+    };
+
+    Block *block = nullptr;
+    const Figure *figure = nullptr;
+
+    template <typename T> void adopt(Node<T> *node)
+    {
+        block = node;
+        figure = &node->figure;
+    }
+
+  public:
+    BasicSharedFigure() = default;
+
+    // Copies the figure once into a payload the handle and its copies share
+    explicit BasicSharedFigure(const Figure &figure)
+    {
+        // Plugin figures have no built-in type to switch on
+        if (const auto *plugin = dynamic_cast<const PluginFigure *>(&figure))
+        {
+            adopt(new Node<PluginFigure>(*plugin));
+            return;
+        }
+
+        FigureRegistry::visit(figure.getType(),
+                              [&]<typename T>() { adopt(new Node<T>(static_cast<const T &>(figure))); });
+    }
+
+    template <typename T, typename... Args> static BasicSharedFigure make(Args &&...args)
+    {
+        BasicSharedFigure shared;
+        shared.adopt(new Node<T>(std::forward<Args>(args)...));
+        return shared;
+    }
+
+    BasicSharedFigure(const BasicSharedFigure &other) : block(other.block), figure(other.figure)
+    {
+        if (block != nullptr)
+        {
+            block->refs.acquire();
+        }
+    }
+
+    BasicSharedFigure(BasicSharedFigure &&other) noexcept
+        : block(std::exchange(other.block, nullptr)), figure(std::exchange(other.figure, nullptr))
+    {
+    }
+
+    BasicSharedFigure &operator=(BasicSharedFigure other) noexcept
+    {
+        std::swap(block, other.block);
+        std::swap(figure, other.figure);
+        return *this;
+    }
+
+    ~BasicSharedFigure()
+    {
+        if (block != nullptr && block->refs.release())
+        {
+            delete block;
+        }
+    }
+
+    const Figure &operator*() const
+    {
+        return *figure;
+    }
+
+    const Figure *operator->() const
+    {
+        return figure;
+    }
+
+    const Figure *get() const
+    {
+        return figure;
+    }
+
+    explicit operator bool() const
+    {
+        return figure != nullptr;
+    }
+
+    // The number of handles sharing the payload, 0 for an empty handle
+    std::size_t useCount() const
+    {
+        return block == nullptr ? 0 : block->refs.get();
+    }
+
+    std::unique_ptr<Figure> deepCopy() const
+    {
+        return std::unique_ptr<Figure>(figure->clone());
+    }
+};
+
+using SharedFigure = BasicSharedFigure<LocalRefCount>;
+using AtomicSharedFigure = BasicSharedFigure<AtomicRefCount>;
+
+#endif // FIGURES_SHAREDFIGURE_HPP
@@ -1,36 +1,69 @@
 #include "Triangle.hpp"
 
 #include <cmath>
-#include <sstream>
 #include <stdexcept>
 
-void Triangle::validate_side(const double side, const std::string &name)
+std::optional<ParseError::Code> Triangle::validate(const double a, const double b, const double c)
 {
-    if (side <= 0 || !std::isfinite(side))
+    if (a <= 0 || !std::isfinite(a))
     {
-        throw std::invalid_argument("'" + name + "' must be a finite positive value");
+        return ParseError::INVALID_SIDE_A;
+    }
+
+    if (b <= 0 || !std::isfinite(b))
+    {
+        return ParseError::INVALID_SIDE_B;
+    }
+
+    if (c <= 0 || !std::isfinite(c))
+    {
+        return ParseError::INVALID_SIDE_C;
     }
-}
 
-void Triangle::validate_triangle(const double a, const double b, const double c)
-{
     if (!((a + b > c) && (b + c > a) && (a + c > b)))
     {
-        throw std::invalid_argument("No triangle with such sides exist!");
+        return ParseError::INVALID_TRIANGLE;
     }
+
+    if (!std::isfinite(a + b + c))
+    {
+        return ParseError::INVALID_PERIMETER;
+    }
+
+    return std::nullopt;
 }
 
 Triangle::Triangle(const double a, const double b, const double c) : a(a), b(b), c(c)
 {
-    validate_side(a, "a");
-    validate_side(b, "b");
-    validate_side(c, "c");
-    validate_triangle(a, b, c);
+    if (const std::optional<ParseError::Code> error = validate(a, b, c))
+    {
+        throw std::invalid_argument(ParseError::describe(*error));
+    }
+}
 
-    if (!std::isfinite(Triangle::perimeter()))
+std::expected<Triangle, ParseError::Code> Triangle::tryCreate(const double a, const double b, const double c)
+{
+    if (const std::optional<ParseError::Code> error = validate(a, b, c))
     {
-        throw std::invalid_argument("Perimeter must be a finite positive value");
+        return std::unexpected(*error);
     }
+
+    return Triangle(a, b, c);
+}
+
+double Triangle::getA() const
+{
+    return a;
+}
+
+double Triangle::getB() const
+{
+    return b;
+}
+
+double Triangle::getC() const
+{
+    return c;
 }
 
 double Triangle::perimeter() const
@@ -38,14 +71,28 @@ double Triangle::perimeter() const
     return a + b + c;
 }
 
-std::string Triangle::toString() const
+FigureUtil::FigureType Triangle::getType() const
+{
+    return FigureUtil::TRIANGLE;
+}
+
+char *Triangle::formatTo(char *buffer) const
 {
-    std::stringstream sstream;
-    sstream << "Triangle " << a << " " << b << " " << c;
-    return sstream.str();
+    buffer = appendText(buffer, DISPLAY_NAME);
+    *buffer++ = ' ';
+    buffer = appendNumber(buffer, a);
+    *buffer++ = ' ';
+    buffer = appendNumber(buffer, b);
+    *buffer++ = ' ';
+    return appendNumber(buffer, c);
 }
 
 Triangle *Triangle::clone() const
 {
     return new Triangle(a, b, c);
 }
+
+Triangle *Triangle::clone(std::pmr::memory_resource &resource) const
+{
+    return std::pmr::polymorphic_allocator<>(&resource).new_object<Triangle>(a, b, c);
+}
@@ -1,7 +1,12 @@
 #ifndef FIGURES_TRIANGLE_HPP
 #define FIGURES_TRIANGLE_HPP
 
+#include <expected>
+#include <optional>
+#include <string_view>
+
 #include "../Figure.hpp"
+#include "../../util/parse_error/ParseError.hpp"
 
 class Triangle final : public Figure
 {
@@ -10,18 +15,33 @@ class Triangle final : public Figure
     const double b;
     const double c;
 
-    static void validate_side(double side, const std::string &name);
-
-    static void validate_triangle(double a, double b, double c);
+    static std::optional<ParseError::Code> validate(double a, double b, double c);
 
   public:
+    static constexpr FigureUtil::FigureType TYPE = FigureUtil::TRIANGLE;
+    static constexpr std::string_view NAME = "triangle";
+    static constexpr std::string_view DISPLAY_NAME = "Triangle";
+    static constexpr unsigned PARAMS = 3;
+
     Triangle(double a, double b, double c);
 
+    static std::expected<Triangle, ParseError::Code> tryCreate(double a, double b, double c);
+
+    double getA() const;
+
+    double getB() const;
+
+    double getC() const;
+
     double perimeter() const override;
 
-    std::string toString() const override;
+    FigureUtil::FigureType getType() const override;
+
+    using Figure::formatTo;
+    char *formatTo(char *buffer) const override;
 
     Triangle *clone() const override;
+    Triangle *clone(std::pmr::memory_resource &resource) const override;
 };
 
 #endif // FIGURES_TRIANGLE_HPP
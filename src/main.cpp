@@ -1,9 +1,35 @@
 #include <iostream>
+#include <span>
 
 #include "../src/application/Application.hpp"
+#include "../src/application/command_line/CommandLine.hpp"
 
-int main()
+int main(int argc, char *argv[])
 {
+    if (argc > 1)
+    {
+        try
+        {
+            const CommandLine::Options options =
+                CommandLine::parse(std::span<const char *const>(argv + 1, static_cast<std::size_t>(argc - 1)));
+
+            if (options.help)
+            {
+                std::cout << CommandLine::USAGE;
+                return 0;
+            }
+
+            Application::getInstance().runBatch(options);
+        }
+        catch (std::exception &e)
+        {
+            std::cerr << e.what() << "\nRun 'figures --help' for usage.\n";
+            return 1;
+        }
+
+        return 0;
+    }
+
     try
     {
         Application::getInstance().run();
@@ -0,0 +1,5 @@
+#include "FigureSink.hpp"
+
+void FigureSink::finish()
+{
+}
@@ -0,0 +1,14 @@
+#ifndef FIGURES_FIGURESINK_HPP
+#define FIGURES_FIGURESINK_HPP
+
+class FigureStore;
+
+class FigureSink
+{
+  public:
+    virtual void write(const FigureStore &chunk) = 0;
+    virtual void finish();
+    virtual ~FigureSink() = default;
+};
+
+#endif // FIGURES_FIGURESINK_HPP
@@ -0,0 +1,13 @@
+#ifndef FIGURES_PIPELINESTAGE_HPP
+#define FIGURES_PIPELINESTAGE_HPP
+
+class FigureStore;
+
+class PipelineStage
+{
+  public:
+    virtual void process(FigureStore &chunk) = 0;
+    virtual ~PipelineStage() = default;
+};
+
+#endif // FIGURES_PIPELINESTAGE_HPP
@@ -0,0 +1,13 @@
+#include "AggregateStage.hpp"
+
+#include "../../store/figure_store/FigureStore.hpp"
+
+void AggregateStage::process(FigureStore &chunk)
+{
+    aggregates.merge(chunk.getAggregates());
+}
+
+const FigureAggregates &AggregateStage::getAggregates() const
+{
+    return aggregates;
+}
@@ -0,0 +1,18 @@
+#ifndef FIGURES_AGGREGATESTAGE_HPP
+#define FIGURES_AGGREGATESTAGE_HPP
+
+#include "../../store/figure_aggregates/FigureAggregates.hpp"
+#include "../PipelineStage.hpp"
+
+// Counts the figures passing through and tracks the sum, minimum and maximum of their perimeters
+class AggregateStage final : public PipelineStage
+{
+    FigureAggregates aggregates;
+
+  public:
+    void process(FigureStore &chunk) override;
+
+    const FigureAggregates &getAggregates() const;
+};
+
+#endif // FIGURES_AGGREGATESTAGE_HPP
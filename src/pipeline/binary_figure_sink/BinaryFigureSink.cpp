@@ -0,0 +1,158 @@
+#include "BinaryFigureSink.hpp"
+
+#include <span>
+#include <stdexcept>
+
+#include "../../figure/plugin_figure/PluginFigure.hpp"
+#include "../../store/figure_store/FigureStore.hpp"
+
+void BinaryFigureSink::FileCloser::operator()(std::FILE *file) const
+{
+    std::fclose(file);
+}
+
+unsigned BinaryFigureSink::columnIndex(const FigureUtil::FigureType type, const unsigned param)
+{
+    return type * FigureUtil::MAX_FIGURE_PARAMS + param;
+}
+
+void BinaryFigureSink::throwWriteError() const
+{
+    throw std::runtime_error("Cannot write file: '" + filename + "'");
+}
+
+void BinaryFigureSink::spill(const std::vector<char> &buffer, std::FILE *file) const
+{
+    if (!buffer.empty() && std::fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size())
+    {
+        throwWriteError();
+    }
+}
+
+void BinaryFigureSink::copyToOutput(std::FILE *file, std::vector<char> &block)
+{
+    std::rewind(file);
+    for (std::size_t read; (read = std::fread(block.data(), 1, block.size(), file)) > 0;)
+    {
+        output.write(block.data(), static_cast<std::streamsize>(read));
+    }
+
+    if (std::ferror(file))
+    {
+        throwWriteError();
+    }
+}
+
+BinaryFigureSink::BinaryFigureSink(std::string filename)
+    : filename(std::move(filename)), output(this->filename, std::ios::binary)
+{
+    if (!output.is_open())
+    {
+        throw std::runtime_error("Cannot open file: '" + this->filename + "'");
+    }
+
+    for (unsigned type = 0; type < FigureUtil::FIGURE_NUM; type++)
+    {
+        const auto figureType = static_cast<FigureUtil::FigureType>(type);
+        for (unsigned param = 0; param < FigureUtil::getFigureParams(figureType); param++)
+        {
+            std::unique_ptr<std::FILE, FileCloser> &column = columns[columnIndex(figureType, param)];
+
+            column.reset(std::tmpfile());
+            if (column == nullptr)
+            {
+                throw std::runtime_error("Cannot create a temporary file for '" + this->filename + "'");
+            }
+        }
+    }
+
+    // Reserve the header; finish() rewrites it once the counts are known
+    BinaryFigureFormat::writeHeader(output, header);
+}
+
+void BinaryFigureSink::write(const FigureStore &chunk)
+{
+    typeBuffer.clear();
+    pluginBuffer.clear();
+    for (std::vector<char> &buffer : columnBuffers)
+    {
+        buffer.clear();
+    }
+
+    const std::span<const FigureStore::Entry> entries = chunk.getEntries();
+    for (const FigureStore::Entry entry : entries)
+    {
+        if (entry.type == FigureStore::VACANT)
+        {
+            continue;
+        }
+
+        typeBuffer.push_back(static_cast<char>(entry.type));
+        if (entry.type == FigureStore::PLUGIN)
+        {
+            const PluginFigure &figure = chunk.getPluginFigures()[entry.row];
+            BinaryFigureFormat::appendPluginRecord(pluginBuffer, pluginTypes.indexOf(figure), figure.getParams());
+            continue;
+        }
+
+        const auto type = static_cast<FigureUtil::FigureType>(entry.type);
+        header.typeCounts[type]++;
+
+        for (unsigned param = 0; param < FigureUtil::getFigureParams(type); param++)
+        {
+            std::vector<char> &buffer = columnBuffers[columnIndex(type, param)];
+            buffer.resize(buffer.size() + sizeof(double));
+            BinaryFigureFormat::writeDouble(buffer.data() + buffer.size() - sizeof(double),
+                                            chunk.getColumn(type, param)[entry.row]);
+        }
+    }
+    header.figureCount += chunk.size();
+
+    output.write(typeBuffer.data(), static_cast<std::streamsize>(typeBuffer.size()));
+    for (unsigned i = 0; i < COLUMN_NUM; i++)
+    {
+        spill(columnBuffers[i], columns[i].get());
+    }
+
+    if (!pluginBuffer.empty())
+    {
+        if (pluginRecords == nullptr)
+        {
+            pluginRecords.reset(std::tmpfile());
+            if (pluginRecords == nullptr)
+            {
+                throw std::runtime_error("Cannot create a temporary file for '" + filename + "'");
+            }
+            header.version = BinaryFigureFormat::PLUGIN_VERSION;
+        }
+        spill(pluginBuffer, pluginRecords.get());
+    }
+}
+
+void BinaryFigureSink::finish()
+{
+    std::vector<char> block(1 << 20);
+
+    for (const std::unique_ptr<std::FILE, FileCloser> &column : columns)
+    {
+        if (column != nullptr)
+        {
+            copyToOutput(column.get(), block);
+        }
+    }
+
+    if (pluginRecords != nullptr)
+    {
+        BinaryFigureFormat::writePluginTable(output, pluginTypes.get());
+        copyToOutput(pluginRecords.get(), block);
+    }
+
+    output.seekp(0);
+    BinaryFigureFormat::writeHeader(output, header);
+
+    output.flush();
+    if (output.fail())
+    {
+        throwWriteError();
+    }
+}
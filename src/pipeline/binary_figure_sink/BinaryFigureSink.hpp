@@ -0,0 +1,52 @@
+#ifndef FIGURES_BINARYFIGURESINK_HPP
+#define FIGURES_BINARYFIGURESINK_HPP
+
+#include <array>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../util/binary_figure_format/BinaryFigureFormat.hpp"
+#include "../../util/figure_util/FigureUtil.hpp"
+#include "../FigureSink.hpp"
+
+// Streams figures into the binary figure format without holding them in memory: the figure types go straight to
+// the file, each parameter column is spilled to a temporary file, and finish() appends the columns and fills in
+// the header. Plugin figure records are spilled the same way and follow the columns with their type table
+class BinaryFigureSink final : public FigureSink
+{
+  private:
+    static constexpr unsigned COLUMN_NUM = FigureUtil::FIGURE_NUM * FigureUtil::MAX_FIGURE_PARAMS;
+
+    struct FileCloser
+    {
+        void operator()(std::FILE *file) const;
+    };
+
+    const std::string filename;
+    std::ofstream output;
+    BinaryFigureFormat::Header header{};
+    std::array<std::unique_ptr<std::FILE, FileCloser>, COLUMN_NUM> columns;
+    std::array<std::vector<char>, COLUMN_NUM> columnBuffers;
+    std::vector<char> typeBuffer;
+    BinaryFigureFormat::PluginTypes pluginTypes;
+    std::unique_ptr<std::FILE, FileCloser> pluginRecords;
+    std::vector<char> pluginBuffer;
+
+    static unsigned columnIndex(FigureUtil::FigureType type, unsigned param);
+
+    void spill(const std::vector<char> &buffer, std::FILE *file) const;
+    void copyToOutput(std::FILE *file, std::vector<char> &block);
+
+    [[noreturn]] void throwWriteError() const;
+
+  public:
+    explicit BinaryFigureSink(std::string filename);
+
+    void write(const FigureStore &chunk) override;
+    void finish() override;
+};
+
+#endif // FIGURES_BINARYFIGURESINK_HPP
@@ -0,0 +1,63 @@
+#include "FigurePipeline.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "../../store/figure_store/FigureStore.hpp"
+
+FigurePipeline::FigurePipeline(const std::size_t chunkSize) : chunkSize(chunkSize)
+{
+    if (chunkSize == 0)
+    {
+        throw std::invalid_argument("Pipeline chunk size must be positive");
+    }
+}
+
+PipelineStage &FigurePipeline::addStage(std::unique_ptr<PipelineStage> stage)
+{
+    stages.push_back(std::move(stage));
+    return *stages.back();
+}
+
+FigureSink &FigurePipeline::addSink(std::unique_ptr<FigureSink> sink)
+{
+    sinks.push_back(std::move(sink));
+    return *sinks.back();
+}
+
+std::size_t FigurePipeline::run(FigureFactory &source, const std::size_t count)
+{
+    FigureStore chunk;
+    std::size_t read = 0;
+
+    while (read < count)
+    {
+        chunk.clear();
+
+        const std::size_t wanted = std::min(chunkSize, count - read);
+        const std::size_t created = source.createBatch(wanted, chunk);
+        read += created;
+
+        for (const std::unique_ptr<PipelineStage> &stage : stages)
+        {
+            stage->process(chunk);
+        }
+
+        for (const std::unique_ptr<FigureSink> &sink : sinks)
+        {
+            sink->write(chunk);
+        }
+
+        if (created < wanted)
+        {
+            break;
+        }
+    }
+
+    for (const std::unique_ptr<FigureSink> &sink : sinks)
+    {
+        sink->finish();
+    }
+
+    return read;
+}
@@ -0,0 +1,33 @@
+#ifndef FIGURES_FIGUREPIPELINE_HPP
+#define FIGURES_FIGUREPIPELINE_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "../../factory/FigureFactory.hpp"
+#include "../FigureSink.hpp"
+#include "../PipelineStage.hpp"
+
+// Pulls figures from a factory one chunk at a time, so memory stays bounded by the chunk size however many
+// figures flow through
+class FigurePipeline
+{
+  public:
+    static constexpr std::size_t DEFAULT_CHUNK_SIZE = 1 << 16;
+
+  private:
+    const std::size_t chunkSize;
+    std::vector<std::unique_ptr<PipelineStage>> stages;
+    std::vector<std::unique_ptr<FigureSink>> sinks;
+
+  public:
+    explicit FigurePipeline(std::size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+    PipelineStage &addStage(std::unique_ptr<PipelineStage> stage);
+    FigureSink &addSink(std::unique_ptr<FigureSink> sink);
+
+    std::size_t run(FigureFactory &source, std::size_t count);
+};
+
+#endif // FIGURES_FIGUREPIPELINE_HPP
@@ -0,0 +1,50 @@
+#include "FilterStage.hpp"
+
+#include <stdexcept>
+#include <utility>
+
+FilterStage::FilterStage()
+{
+    types.fill(true);
+}
+
+void FilterStage::setTypes(const std::span<const FigureUtil::FigureType> types)
+{
+    this->types.fill(types.empty());
+    for (const FigureUtil::FigureType type : types)
+    {
+        this->types[type] = true;
+    }
+}
+
+void FilterStage::setPerimeterRange(const double minPerimeter, const double maxPerimeter)
+{
+    if (!(minPerimeter <= maxPerimeter))
+    {
+        throw std::invalid_argument("Minimum perimeter must not exceed the maximum perimeter");
+    }
+
+    this->minPerimeter = minPerimeter;
+    this->maxPerimeter = maxPerimeter;
+}
+
+bool FilterStage::matches(const std::uint8_t type, const double perimeter) const
+{
+    return types[type] && perimeter >= minPerimeter && perimeter <= maxPerimeter;
+}
+
+void FilterStage::process(FigureStore &chunk)
+{
+    kept.clear();
+
+    const std::span<const FigureStore::Entry> entries = chunk.getEntries();
+    for (std::size_t i = 0; i < entries.size(); i++)
+    {
+        if (entries[i].type != FigureStore::VACANT && matches(entries[i].type, chunk.perimeterAt(i)))
+        {
+            kept.append(chunk, i, 1);
+        }
+    }
+
+    std::swap(chunk, kept);
+}
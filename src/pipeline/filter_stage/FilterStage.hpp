@@ -0,0 +1,35 @@
+#ifndef FIGURES_FILTERSTAGE_HPP
+#define FIGURES_FILTERSTAGE_HPP
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <span>
+
+#include "../../store/figure_store/FigureStore.hpp"
+#include "../../util/figure_util/FigureUtil.hpp"
+#include "../PipelineStage.hpp"
+
+// Keeps the figures of the selected types whose perimeter lies in [minPerimeter, maxPerimeter]. Plugin figures
+// have no FigureType to select, so they are kept only when no types are selected
+class FilterStage final : public PipelineStage
+{
+  private:
+    // Indexed by FigureStore entry type, the last one being FigureStore::PLUGIN
+    std::array<bool, FigureStore::PLUGIN + 1> types{};
+    double minPerimeter = 0;
+    double maxPerimeter = std::numeric_limits<double>::infinity();
+    FigureStore kept;
+
+  public:
+    FilterStage();
+
+    void setTypes(std::span<const FigureUtil::FigureType> types);
+    void setPerimeterRange(double minPerimeter, double maxPerimeter);
+
+    bool matches(std::uint8_t type, double perimeter) const;
+
+    void process(FigureStore &chunk) override;
+};
+
+#endif // FIGURES_FILTERSTAGE_HPP
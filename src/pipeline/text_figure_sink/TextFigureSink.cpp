@@ -0,0 +1,50 @@
+#include "TextFigureSink.hpp"
+
+#include <charconv>
+
+#include "../../store/figure_store/FigureStore.hpp"
+
+TextFigureSink::TextFigureSink(std::ostream &output, const bool numbered) : output(output), numbered(numbered)
+{
+    buffer.reserve(FLUSH_SIZE + Figure::MAX_FORMATTED_SIZE + 32);
+}
+
+void TextFigureSink::flush()
+{
+    output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    buffer.clear();
+}
+
+void TextFigureSink::write(const FigureStore &chunk)
+{
+    for (std::size_t i = 0; i < chunk.slotCount(); i++)
+    {
+        if (!chunk.contains(i))
+        {
+            continue;
+        }
+
+        if (numbered)
+        {
+            char digits[24];
+            buffer.append(digits, std::to_chars(digits, digits + sizeof(digits), index + i).ptr);
+            buffer += ". ";
+        }
+
+        chunk.formatTo(i, buffer);
+        buffer += '\n';
+
+        if (buffer.size() >= FLUSH_SIZE)
+        {
+            flush();
+        }
+    }
+
+    index += chunk.slotCount();
+}
+
+void TextFigureSink::finish()
+{
+    flush();
+    output.flush();
+}
@@ -0,0 +1,30 @@
+#ifndef FIGURES_TEXTFIGURESINK_HPP
+#define FIGURES_TEXTFIGURESINK_HPP
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+
+#include "../FigureSink.hpp"
+
+// Writes one figure per line in 64 KiB blocks, optionally prefixed with its slot number counted across chunks
+class TextFigureSink final : public FigureSink
+{
+  private:
+    static constexpr std::size_t FLUSH_SIZE = 1 << 16;
+
+    std::ostream &output;
+    const bool numbered;
+    std::size_t index = 0;
+    std::string buffer;
+
+    void flush();
+
+  public:
+    TextFigureSink(std::ostream &output, bool numbered);
+
+    void write(const FigureStore &chunk) override;
+    void finish() override;
+};
+
+#endif // FIGURES_TEXTFIGURESINK_HPP
@@ -0,0 +1,307 @@
+#include "FigureQuery.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+#include <string>
+
+#include "../../util/parallel_blocks/ParallelBlocks.hpp"
+
+namespace
+{
+bool satisfies(const double value, const FigureQuery::Comparison comparison, const double bound)
+{
+    switch (comparison)
+    {
+    case FigureQuery::LESS:
+        return value < bound;
+    case FigureQuery::LESS_EQUAL:
+        return value <= bound;
+    case FigureQuery::GREATER:
+        return value > bound;
+    case FigureQuery::GREATER_EQUAL:
+        return value >= bound;
+    case FigureQuery::EQUAL:
+        return value == bound;
+    }
+
+    return false;
+}
+
+std::string quoted(const std::string_view text)
+{
+    return "'" + std::string(text) + "'";
+}
+} // namespace
+
+FigureQuery::FigureQuery()
+{
+    types.fill(true);
+}
+
+FigureQuery::Field FigureQuery::parseField(const std::string_view name)
+{
+    constexpr std::array<std::string_view, 8> names = {"number", "perimeter", "a",     "b",
+                                                       "c",      "radius",    "width", "height"};
+
+    const auto found = std::ranges::find(names, name);
+    if (found == names.end())
+    {
+        throw std::invalid_argument("Unknown query field: " + quoted(name));
+    }
+
+    return static_cast<Field>(found - names.begin());
+}
+
+std::optional<double> FigureQuery::valueOf(const FigureStore &store, const std::size_t number, const Field field)
+{
+    const FigureStore::Entry entry = store.getEntries()[number];
+
+    const auto column = [&](const FigureUtil::FigureType type, const unsigned param) -> std::optional<double> {
+        if (entry.type != type)
+        {
+            return std::nullopt;
+        }
+        return store.getColumn(type, param)[entry.row];
+    };
+
+    switch (field)
+    {
+    case NUMBER:
+        return static_cast<double>(number);
+    case PERIMETER:
+        return store.perimeterAt(number);
+    case SIDE_A:
+        return column(FigureUtil::TRIANGLE, 0);
+    case SIDE_B:
+        return column(FigureUtil::TRIANGLE, 1);
+    case SIDE_C:
+        return column(FigureUtil::TRIANGLE, 2);
+    case RADIUS:
+        return column(FigureUtil::CIRCLE, 0);
+    case WIDTH:
+        return column(FigureUtil::RECTANGLE, 0);
+    case HEIGHT:
+        return column(FigureUtil::RECTANGLE, 1);
+    }
+
+    return std::nullopt;
+}
+
+bool FigureQuery::before(const Match &left, const Match &right) const
+{
+    if (left.key != right.key)
+    {
+        return descending ? left.key > right.key : left.key < right.key;
+    }
+
+    return left.number < right.number;
+}
+
+void FigureQuery::scan(const FigureStore &store, const std::size_t first, const std::size_t last,
+                       std::vector<Match> &matches) const
+{
+    const std::span<const FigureStore::Entry> entries = store.getEntries();
+    const auto worse = [this](const Match &left, const Match &right) { return before(left, right); };
+    const bool numberOrder = sortField == NUMBER && !descending;
+
+    for (std::size_t number = first; number < last; number++)
+    {
+        const std::uint8_t type = entries[number].type;
+        if (type == FigureStore::VACANT || !types[type])
+        {
+            continue;
+        }
+
+        const bool accepted = std::ranges::all_of(predicates, [&](const Predicate &predicate) {
+            const std::optional<double> value = valueOf(store, number, predicate.field);
+            return value.has_value() && satisfies(*value, predicate.comparison, predicate.value);
+        });
+        const std::optional<double> key = accepted ? valueOf(store, number, sortField) : std::nullopt;
+        if (!key.has_value())
+        {
+            continue;
+        }
+
+        if (!limit.has_value())
+        {
+            matches.push_back({*key, number});
+            continue;
+        }
+
+        // A heap whose front is the match that would come last, so it is the one replaced by a better match
+        if (matches.size() < *limit)
+        {
+            matches.push_back({*key, number});
+            std::ranges::push_heap(matches, worse);
+        }
+        else if (before({*key, number}, matches.front()))
+        {
+            std::ranges::pop_heap(matches, worse);
+            matches.back() = {*key, number};
+            std::ranges::push_heap(matches, worse);
+        }
+
+        if (numberOrder && matches.size() == *limit)
+        {
+            break;
+        }
+    }
+}
+
+void FigureQuery::setTypes(const std::span<const FigureUtil::FigureType> types)
+{
+    this->types.fill(types.empty());
+    for (const FigureUtil::FigureType type : types)
+    {
+        this->types[type] = true;
+    }
+}
+
+void FigureQuery::addPredicate(const Predicate predicate)
+{
+    predicates.push_back(predicate);
+}
+
+void FigureQuery::sortBy(const Field field, const bool descending)
+{
+    sortField = field;
+    this->descending = descending;
+}
+
+void FigureQuery::setLimit(const std::size_t limit)
+{
+    if (limit == 0)
+    {
+        throw std::invalid_argument("Query limit must be positive");
+    }
+
+    this->limit = limit;
+}
+
+FigureQuery FigureQuery::parse(const std::string_view text)
+{
+    FigureQuery query;
+    std::vector<FigureUtil::FigureType> types;
+
+    std::size_t begin = text.find_first_not_of(" \t");
+    while (begin != std::string_view::npos)
+    {
+        const std::size_t end = std::min(text.find_first_of(" \t", begin), text.size());
+        const std::string_view term = text.substr(begin, end - begin);
+        begin = text.find_first_not_of(" \t", end);
+
+        const std::expected<FigureUtil::FigureType, ParseError::Code> type =
+            FigureUtil::tryStrToFigure(std::string(term));
+        if (type.has_value())
+        {
+            types.push_back(*type);
+            continue;
+        }
+
+        if (term.starts_with("sort="))
+        {
+            const std::string_view field = term.substr(5);
+            const bool descending = field.starts_with('-');
+            query.sortBy(parseField(descending ? field.substr(1) : field), descending);
+            continue;
+        }
+
+        if (term.starts_with("limit="))
+        {
+            const std::string_view value = term.substr(6);
+            std::size_t limit = 0;
+            const std::from_chars_result result = std::from_chars(value.data(), value.data() + value.size(), limit);
+
+            if (result.ec != std::errc() || result.ptr != value.data() + value.size() || limit == 0)
+            {
+                throw std::invalid_argument("Invalid query limit: " + quoted(value));
+            }
+
+            query.setLimit(limit);
+            continue;
+        }
+
+        const std::size_t op = term.find_first_of("<>=");
+        if (op == std::string_view::npos || op == 0)
+        {
+            throw std::invalid_argument("Invalid query term: " + quoted(term));
+        }
+
+        Predicate predicate{parseField(term.substr(0, op)), EQUAL, 0};
+        std::string_view value = term.substr(op + 1);
+
+        if (term[op] != '=')
+        {
+            const bool orEqual = value.starts_with('=');
+            value.remove_prefix(orEqual ? 1 : 0);
+            if (term[op] == '<')
+            {
+                predicate.comparison = orEqual ? LESS_EQUAL : LESS;
+            }
+            else
+            {
+                predicate.comparison = orEqual ? GREATER_EQUAL : GREATER;
+            }
+        }
+
+        const std::from_chars_result result =
+            std::from_chars(value.data(), value.data() + value.size(), predicate.value);
+        if (result.ec != std::errc() || result.ptr != value.data() + value.size() || value.empty())
+        {
+            throw std::invalid_argument("Invalid query value: " + quoted(value));
+        }
+
+        query.addPredicate(predicate);
+    }
+
+    query.setTypes(types);
+    return query;
+}
+
+std::vector<std::size_t> FigureQuery::execute(const FigureStore &store, const unsigned threads) const
+{
+    if (threads == 0)
+    {
+        throw std::invalid_argument("Number of threads must be greater than 0");
+    }
+
+    std::vector<Match> matches;
+    const std::size_t slots = store.slotCount();
+
+    if (threads == 1 || slots < PARALLEL_THRESHOLD)
+    {
+        scan(store, 0, slots, matches);
+    }
+    else
+    {
+        std::vector<std::vector<Match>> parts(threads);
+        ParallelBlocks::forEach(threads, slots, [&](const unsigned t, const std::size_t first, const std::size_t last) {
+            scan(store, first, last, parts[t]);
+        });
+
+        for (const std::vector<Match> &part : parts)
+        {
+            matches.insert(matches.end(), part.begin(), part.end());
+        }
+    }
+
+    if (sortField != NUMBER || descending || limit.has_value())
+    {
+        std::ranges::sort(matches, [this](const Match &left, const Match &right) { return before(left, right); });
+    }
+
+    if (limit.has_value() && matches.size() > *limit)
+    {
+        matches.resize(*limit);
+    }
+
+    std::vector<std::size_t> numbers;
+    numbers.reserve(matches.size());
+    for (const Match &match : matches)
+    {
+        numbers.push_back(match.number);
+    }
+
+    return numbers;
+}
@@ -0,0 +1,91 @@
+#ifndef FIGURES_FIGUREQUERY_HPP
+#define FIGURES_FIGUREQUERY_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "../../store/figure_store/FigureStore.hpp"
+#include "../../util/figure_util/FigureUtil.hpp"
+
+// Selects figures by type and by predicates on their perimeter or dimensions, orders them by a sort key and keeps
+// the first 'limit' of them, all in one scan over the store. A predicate or sort key on a dimension only matches
+// the figure types that have that dimension. Plugin figures have no type to select and no named dimensions, so they
+// match only queries without types and with predicates and sort keys on the number or perimeter.
+class FigureQuery
+{
+  public:
+    enum Field : std::uint8_t
+    {
+        NUMBER = 0,
+        PERIMETER,
+        SIDE_A,
+        SIDE_B,
+        SIDE_C,
+        RADIUS,
+        WIDTH,
+        HEIGHT
+    };
+
+    enum Comparison : std::uint8_t
+    {
+        LESS = 0,
+        LESS_EQUAL,
+        GREATER,
+        GREATER_EQUAL,
+        EQUAL
+    };
+
+    struct Predicate
+    {
+        Field field;
+        Comparison comparison;
+        double value;
+    };
+
+    static constexpr std::string_view SYNTAX =
+        "[triangle|circle|rectangle]... [<field><op><value>]... [sort=[-]<field>] [limit=<n>]\n"
+        "  fields: number, perimeter, a, b, c, radius, width, height; ops: <, <=, >, >=, =\n"
+        "  e.g. 'triangle perimeter>1e6 sort=-perimeter limit=100'\n";
+
+  private:
+    static constexpr std::size_t PARALLEL_THRESHOLD = 1 << 16;
+
+    struct Match
+    {
+        double key;
+        std::size_t number;
+    };
+
+    // Indexed by FigureStore entry type, the last one being FigureStore::PLUGIN
+    std::array<bool, FigureStore::PLUGIN + 1> types{};
+    std::vector<Predicate> predicates;
+    Field sortField = NUMBER;
+    bool descending = false;
+    std::optional<std::size_t> limit;
+
+    static Field parseField(std::string_view name);
+    static std::optional<double> valueOf(const FigureStore &store, std::size_t number, Field field);
+
+    bool before(const Match &left, const Match &right) const;
+    void scan(const FigureStore &store, std::size_t first, std::size_t last, std::vector<Match> &matches) const;
+
+  public:
+    FigureQuery();
+
+    void setTypes(std::span<const FigureUtil::FigureType> types);
+    void addPredicate(Predicate predicate);
+    void sortBy(Field field, bool descending);
+    void setLimit(std::size_t limit);
+
+    static FigureQuery parse(std::string_view text);
+
+    // The numbers of the matching figures in result order
+    std::vector<std::size_t> execute(const FigureStore &store, unsigned threads = 1) const;
+};
+
+#endif // FIGURES_FIGUREQUERY_HPP
@@ -0,0 +1,151 @@
+#include "FigureAggregates.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace
+{
+// The sum is kept scaled down by 2^32, which is exact for normal perimeters and keeps it finite for up to 2^32
+// figures of the largest perimeter
+constexpr double SUM_SCALE = 0x1p-32;
+} // namespace
+
+void FigureAggregates::addToSum(const double value)
+{
+    const double total = sum + value;
+    if (std::abs(sum) >= std::abs(value))
+    {
+        compensation += (sum - total) + value;
+    }
+    else
+    {
+        compensation += (value - total) + sum;
+    }
+    sum = total;
+}
+
+void FigureAggregates::addPerimeter(const double perimeter)
+{
+    addToSum(perimeter * SUM_SCALE);
+    min = std::min(min, perimeter);
+    max = std::max(max, perimeter);
+}
+
+void FigureAggregates::removePerimeter(const double perimeter)
+{
+    addToSum(-perimeter * SUM_SCALE);
+
+    if (perimeter <= min || perimeter >= max)
+    {
+        stale = true;
+    }
+}
+
+void FigureAggregates::add(const FigureUtil::FigureType type, const double perimeter)
+{
+    typeCounts[type]++;
+    addPerimeter(perimeter);
+}
+
+void FigureAggregates::remove(const FigureUtil::FigureType type, const double perimeter)
+{
+    typeCounts[type]--;
+    removePerimeter(perimeter);
+}
+
+void FigureAggregates::addPlugin(const double perimeter)
+{
+    pluginFigures++;
+    addPerimeter(perimeter);
+}
+
+void FigureAggregates::removePlugin(const double perimeter)
+{
+    pluginFigures--;
+    removePerimeter(perimeter);
+}
+
+void FigureAggregates::merge(const FigureAggregates &other)
+{
+    // Read before updating, so merging an aggregate into itself doubles it
+    const double otherSum = other.sum;
+    const double otherCompensation = other.compensation;
+
+    for (std::size_t type = 0; type < typeCounts.size(); type++)
+    {
+        typeCounts[type] += other.typeCounts[type];
+    }
+    pluginFigures += other.pluginFigures;
+
+    addToSum(otherSum);
+    addToSum(otherCompensation);
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    stale = stale || other.stale;
+}
+
+void FigureAggregates::clear()
+{
+    *this = FigureAggregates();
+}
+
+bool FigureAggregates::isStale() const
+{
+    return stale;
+}
+
+void FigureAggregates::resetPerimeters()
+{
+    sum = 0;
+    compensation = 0;
+    min = std::numeric_limits<double>::infinity();
+    max = -std::numeric_limits<double>::infinity();
+    stale = false;
+}
+
+void FigureAggregates::accumulate(const std::span<const double> perimeters)
+{
+    for (const double perimeter : perimeters)
+    {
+        addToSum(perimeter * SUM_SCALE);
+        min = std::min(min, perimeter);
+        max = std::max(max, perimeter);
+    }
+}
+
+std::size_t FigureAggregates::count() const
+{
+    return std::accumulate(typeCounts.begin(), typeCounts.end(), pluginFigures);
+}
+
+std::size_t FigureAggregates::count(const FigureUtil::FigureType type) const
+{
+    return typeCounts[type];
+}
+
+std::size_t FigureAggregates::pluginCount() const
+{
+    return pluginFigures;
+}
+
+double FigureAggregates::perimeterSum() const
+{
+    return (sum + compensation) / SUM_SCALE;
+}
+
+double FigureAggregates::minPerimeter() const
+{
+    return min;
+}
+
+double FigureAggregates::maxPerimeter() const
+{
+    return max;
+}
+
+double FigureAggregates::meanPerimeter() const
+{
+    const std::size_t n = count();
+    return n == 0 ? 0 : (sum + compensation) / static_cast<double>(n) / SUM_SCALE;
+}
@@ -0,0 +1,52 @@
+#ifndef FIGURES_FIGUREAGGREGATES_HPP
+#define FIGURES_FIGUREAGGREGATES_HPP
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <span>
+
+#include "../../util/figure_util/FigureUtil.hpp"
+
+// Per-type counts and the perimeter sum, minimum and maximum of a collection, updated in O(1) as figures come and
+// go: an added perimeter is compared against the extremes. The sum is compensated (Neumaier), so it stays accurate
+// over billions of figures. Removing a figure that holds the current minimum or maximum marks the perimeters stale,
+// and the owner rescans them on the next read
+class FigureAggregates
+{
+    std::array<std::size_t, FigureUtil::FIGURE_NUM> typeCounts{};
+    std::size_t pluginFigures = 0;
+    double sum = 0;
+    double compensation = 0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+    bool stale = false;
+
+    void addToSum(double value);
+    void addPerimeter(double perimeter);
+    void removePerimeter(double perimeter);
+
+  public:
+    void add(FigureUtil::FigureType type, double perimeter);
+    void remove(FigureUtil::FigureType type, double perimeter);
+    // Plugin figures have no built-in type, so they are counted apart from the per-type counts
+    void addPlugin(double perimeter);
+    void removePlugin(double perimeter);
+    void merge(const FigureAggregates &other);
+    void clear();
+
+    // A rescan clears the perimeter statistics, accumulates every perimeter again and keeps the counts
+    bool isStale() const;
+    void resetPerimeters();
+    void accumulate(std::span<const double> perimeters);
+
+    std::size_t count() const;
+    std::size_t count(FigureUtil::FigureType type) const;
+    std::size_t pluginCount() const;
+    double perimeterSum() const;
+    double minPerimeter() const;
+    double maxPerimeter() const;
+    double meanPerimeter() const;
+};
+
+#endif // FIGURES_FIGUREAGGREGATES_HPP
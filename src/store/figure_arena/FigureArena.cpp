@@ -0,0 +1,28 @@
+#include "FigureArena.hpp"
+
+FigureArena::FigureArena(std::pmr::memory_resource *upstream) : resource(upstream)
+{
+}
+
+Figure *FigureArena::copy(const Figure &figure)
+{
+    Figure *copy = figure.clone(resource);
+    figureCount++;
+    return copy;
+}
+
+std::pmr::memory_resource &FigureArena::getResource()
+{
+    return resource;
+}
+
+std::size_t FigureArena::size() const
+{
+    return figureCount;
+}
+
+void FigureArena::release()
+{
+    resource.release();
+    figureCount = 0;
+}
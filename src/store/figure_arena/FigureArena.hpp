@@ -0,0 +1,41 @@
+#ifndef FIGURES_FIGUREARENA_HPP
+#define FIGURES_FIGUREARENA_HPP
+
+#include <cstddef>
+#include <memory_resource>
+#include <utility>
+
+#include "../../figure/Figure.hpp"
+
+// Owns the figures of one load session in a monotonic buffer: creating a figure is a pointer bump and release()
+// frees them all at once. The figures hold only doubles, so they are dropped without running their destructors
+// and must not be deleted by their users
+class FigureArena
+{
+  private:
+    std::pmr::monotonic_buffer_resource resource;
+    std::size_t figureCount = 0;
+
+  public:
+    explicit FigureArena(std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+
+    FigureArena(const FigureArena &) = delete;
+    FigureArena &operator=(const FigureArena &) = delete;
+
+    template <typename T, typename... Args> T *make(Args &&...args)
+    {
+        T *figure = std::pmr::polymorphic_allocator<>(&resource).new_object<T>(std::forward<Args>(args)...);
+        figureCount++;
+        return figure;
+    }
+
+    Figure *copy(const Figure &figure);
+
+    std::pmr::memory_resource &getResource();
+    std::size_t size() const;
+
+    // Invalidates every figure created from the arena
+    void release();
+};
+
+#endif // FIGURES_FIGUREARENA_HPP
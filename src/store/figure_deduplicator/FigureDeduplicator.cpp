@@ -0,0 +1,167 @@
+#include "FigureDeduplicator.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <stdexcept>
+
+#include "../../util/parallel_blocks/ParallelBlocks.hpp"
+
+namespace
+{
+constexpr std::uint64_t NUMBER_MASK = 0xFFFFFFFF;
+
+// A slot holds the top half of the hash and the figure number plus one, so an empty slot is 0
+std::uint64_t packSlot(const std::uint64_t hash, const std::size_t number)
+{
+    return (hash & ~NUMBER_MASK) | (number + 1);
+}
+
+std::size_t slotNumber(const std::uint64_t slot)
+{
+    return (slot & NUMBER_MASK) - 1;
+}
+} // namespace
+
+FigureDeduplicator::Result FigureDeduplicator::find(const FigureStore &store, unsigned threads,
+                                                    std::vector<std::uint8_t> &duplicates)
+{
+    if (threads == 0)
+    {
+        throw std::invalid_argument("Number of threads must be greater than 0");
+    }
+
+    const std::size_t slots = store.slotCount();
+    if (slots >= NUMBER_MASK)
+    {
+        throw std::length_error("Too many figures to deduplicate");
+    }
+
+    if (slots < PARALLEL_THRESHOLD)
+    {
+        threads = 1;
+    }
+
+    // Start small, betting on many duplicates, and grow whenever the distinct figures fill three quarters of it
+    std::size_t capacity = std::bit_ceil(std::max(MIN_CAPACITY, store.size() / 4));
+
+    while (true)
+    {
+        const std::size_t mask = capacity - 1;
+        const std::size_t maxDistinct = capacity / 4 * 3;
+        std::vector<std::atomic<std::uint64_t>> table(capacity);
+        std::atomic<std::size_t> distinct = 0;
+        std::atomic<std::size_t> duplicateCount = 0;
+        std::atomic<bool> full = false;
+        duplicates.assign(slots, 0);
+
+        // A figure that meets an equal lower-numbered one is a duplicate for good; one that claims or lowers a slot
+        // is only the first of its group so far, since a lower number may still arrive from another thread
+        ParallelBlocks::forEach(threads, slots, [&](unsigned, const std::size_t first, const std::size_t last) {
+            std::size_t found = 0;
+            for (std::size_t number = first; number < last && !full.load(std::memory_order_relaxed); number++)
+            {
+                if (!store.contains(number))
+                {
+                    continue;
+                }
+
+                const std::uint64_t hash = store.hashAt(number);
+                const std::uint64_t desired = packSlot(hash, number);
+
+                for (std::size_t position = hash & mask;; position = (position + 1) & mask)
+                {
+                    std::uint64_t current = table[position].load(std::memory_order_acquire);
+
+                    // A failed exchange leaves the winning figure in 'current', which may be the same content
+                    if (current == 0 &&
+                        table[position].compare_exchange_strong(current, desired, std::memory_order_acq_rel))
+                    {
+                        if (distinct.fetch_add(1, std::memory_order_relaxed) + 1 > maxDistinct)
+                        {
+                            full.store(true, std::memory_order_relaxed);
+                        }
+                        break;
+                    }
+
+                    const bool sameTag = (current & ~NUMBER_MASK) == (hash & ~NUMBER_MASK);
+                    if (sameTag && store.equalAt(number, slotNumber(current)))
+                    {
+                        while (slotNumber(current) > number &&
+                               !table[position].compare_exchange_weak(current, desired, std::memory_order_acq_rel))
+                        {
+                        }
+
+                        if (slotNumber(current) < number)
+                        {
+                            duplicates[number] = 1;
+                            found++;
+                        }
+                        break;
+                    }
+                }
+            }
+            duplicateCount.fetch_add(found, std::memory_order_relaxed);
+        });
+
+        if (full.load())
+        {
+            capacity *= 4;
+            continue;
+        }
+
+        // Only the figures that were first of their group when inserted need a second look
+        ParallelBlocks::forEach(threads, slots, [&](unsigned, const std::size_t first, const std::size_t last) {
+            std::size_t found = 0;
+            for (std::size_t number = first; number < last; number++)
+            {
+                if (duplicates[number] != 0 || !store.contains(number))
+                {
+                    continue;
+                }
+
+                const std::uint64_t hash = store.hashAt(number);
+                for (std::size_t position = hash & mask;; position = (position + 1) & mask)
+                {
+                    const std::uint64_t current = table[position].load(std::memory_order_relaxed);
+                    if (slotNumber(current) == number)
+                    {
+                        break;
+                    }
+
+                    if ((current & ~NUMBER_MASK) == (hash & ~NUMBER_MASK) && store.equalAt(number, slotNumber(current)))
+                    {
+                        duplicates[number] = 1;
+                        found++;
+                        break;
+                    }
+                }
+            }
+            duplicateCount.fetch_add(found, std::memory_order_relaxed);
+        });
+
+        return {store.size(), distinct.load(), duplicateCount.load(), capacity * sizeof(std::uint64_t)};
+    }
+}
+
+FigureDeduplicator::Result FigureDeduplicator::count(const FigureStore &store, const unsigned threads)
+{
+    std::vector<std::uint8_t> duplicates;
+    return find(store, threads, duplicates);
+}
+
+FigureDeduplicator::Result FigureDeduplicator::removeDuplicates(FigureStore &store, const unsigned threads)
+{
+    std::vector<std::uint8_t> duplicates;
+    const Result result = find(store, threads, duplicates);
+
+    for (std::size_t number = 0; number < duplicates.size(); number++)
+    {
+        if (duplicates[number] != 0)
+        {
+            store.remove(number);
+        }
+    }
+
+    return result;
+}
@@ -0,0 +1,38 @@
+#ifndef FIGURES_FIGUREDEDUPLICATOR_HPP
+#define FIGURES_FIGUREDEDUPLICATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../figure_store/FigureStore.hpp"
+
+// Finds the figures whose type and parameters repeat those of a lower-numbered figure. The figures are hashed on
+// several threads into a shared open-addressing table; each slot packs a hash tag with the lowest number seen for
+// its content and is only ever lowered by compare-and-swap, so the result does not depend on thread timing.
+class FigureDeduplicator
+{
+  public:
+    struct Result
+    {
+        std::size_t figures = 0;
+        std::size_t distinct = 0;
+        std::size_t duplicates = 0;
+        std::size_t tableBytes = 0;
+    };
+
+  private:
+    static constexpr std::size_t PARALLEL_THRESHOLD = 1 << 16;
+    static constexpr std::size_t MIN_CAPACITY = 1 << 10;
+
+    // Sets duplicates[i] for every duplicate figure i
+    static Result find(const FigureStore &store, unsigned threads, std::vector<std::uint8_t> &duplicates);
+
+  public:
+    static Result count(const FigureStore &store, unsigned threads = 1);
+
+    // Removes every duplicate, so the lowest-numbered figure of each group is kept under its number
+    static Result removeDuplicates(FigureStore &store, unsigned threads = 1);
+};
+
+#endif // FIGURES_FIGUREDEDUPLICATOR_HPP
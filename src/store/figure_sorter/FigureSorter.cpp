@@ -0,0 +1,220 @@
+#include "FigureSorter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <stdexcept>
+#include <string>
+
+#include "../../util/parallel_blocks/ParallelBlocks.hpp"
+
+namespace
+{
+constexpr std::uint64_t MISSING_KEY = UINT64_MAX;
+} // namespace
+
+FigureSorter::Key FigureSorter::parseKey(const std::string_view name)
+{
+    constexpr std::array<std::string_view, 8> names = {"type", "perimeter", "a",     "b",
+                                                       "c",    "radius",    "width", "height"};
+
+    const auto found = std::ranges::find(names, name);
+    if (found == names.end())
+    {
+        throw std::invalid_argument("Unknown sort key: '" + std::string(name) + "'");
+    }
+
+    return static_cast<Key>(found - names.begin());
+}
+
+std::uint64_t FigureSorter::encode(const double value, const bool descending)
+{
+    // Flipping the sign bit of positive numbers and every bit of negative ones makes the bit patterns compare like
+    // the numbers they encode
+    const auto bits = std::bit_cast<std::uint64_t>(value);
+    const std::uint64_t key = bits >> 63 ? ~bits : bits | (std::uint64_t{1} << 63);
+
+    return descending ? ~key : key;
+}
+
+std::vector<FigureSorter::Item> FigureSorter::extract(const FigureStore &store, const Key key, const bool descending)
+{
+    const std::span<const FigureStore::Entry> entries = store.getEntries();
+    const std::span<const double> a = store.getTriangleA();
+    const std::span<const double> b = store.getTriangleB();
+    const std::span<const double> c = store.getTriangleC();
+    const std::span<const double> radius = store.getCircleRadius();
+    const std::span<const double> width = store.getRectangleWidth();
+    const std::span<const double> height = store.getRectangleHeight();
+
+    const auto dimension = [&](const FigureStore::Entry entry, const FigureUtil::FigureType type,
+                               const std::span<const double> column) {
+        return entry.type == type ? encode(column[entry.row], descending) : MISSING_KEY;
+    };
+
+    std::vector<Item> items;
+    items.reserve(store.size());
+
+    for (std::size_t number = 0; number < entries.size(); number++)
+    {
+        const FigureStore::Entry entry = entries[number];
+        if (entry.type == FigureStore::VACANT)
+        {
+            continue;
+        }
+
+        std::uint64_t value = 0;
+        switch (key)
+        {
+        case TYPE:
+            value = descending ? FigureStore::PLUGIN - entry.type : entry.type;
+            break;
+        case PERIMETER:
+            value = encode(store.perimeterAt(number), descending);
+            break;
+        case SIDE_A:
+            value = dimension(entry, FigureUtil::TRIANGLE, a);
+            break;
+        case SIDE_B:
+            value = dimension(entry, FigureUtil::TRIANGLE, b);
+            break;
+        case SIDE_C:
+            value = dimension(entry, FigureUtil::TRIANGLE, c);
+            break;
+        case RADIUS:
+            value = dimension(entry, FigureUtil::CIRCLE, radius);
+            break;
+        case WIDTH:
+            value = dimension(entry, FigureUtil::RECTANGLE, width);
+            break;
+        case HEIGHT:
+            value = dimension(entry, FigureUtil::RECTANGLE, height);
+            break;
+        }
+
+        items.push_back({value, static_cast<std::uint32_t>(number)});
+    }
+
+    return items;
+}
+
+void FigureSorter::radixSort(std::vector<Item> &items, const unsigned threads)
+{
+    const std::size_t n = items.size();
+    std::vector<Item> buffer(n);
+    std::vector<std::array<std::size_t, BUCKETS>> counts(threads);
+
+    for (unsigned shift = 0; shift < 64; shift += RADIX_BITS)
+    {
+        ParallelBlocks::forEach(threads, n, [&](const unsigned t, const std::size_t first, const std::size_t last) {
+            counts[t].fill(0);
+            for (std::size_t i = first; i < last; i++)
+            {
+                counts[t][(items[i].key >> shift) & (BUCKETS - 1)]++;
+            }
+        });
+
+        // Each thread scatters its block to the slots after those of the lower digits and of the earlier blocks
+        // with the same digit, which keeps the pass stable. A digit shared by every key needs no pass at all.
+        bool skip = false;
+        std::size_t offset = 0;
+        for (std::size_t bucket = 0; bucket < BUCKETS; bucket++)
+        {
+            const std::size_t start = offset;
+            for (unsigned t = 0; t < threads; t++)
+            {
+                const std::size_t count = counts[t][bucket];
+                counts[t][bucket] = offset;
+                offset += count;
+            }
+            skip = skip || offset - start == n;
+        }
+
+        if (skip)
+        {
+            continue;
+        }
+
+        ParallelBlocks::forEach(threads, n, [&](const unsigned t, const std::size_t first, const std::size_t last) {
+            for (std::size_t i = first; i < last; i++)
+            {
+                buffer[counts[t][(items[i].key >> shift) & (BUCKETS - 1)]++] = items[i];
+            }
+        });
+        items.swap(buffer);
+    }
+}
+
+void FigureSorter::mergeSort(std::vector<Item> &items, const unsigned threads)
+{
+    const auto before = [](const Item &left, const Item &right) {
+        return left.key < right.key || (left.key == right.key && left.number < right.number);
+    };
+
+    const std::size_t n = items.size();
+    const std::size_t blockSize = (n + threads - 1) / threads;
+
+    ParallelBlocks::forEach(threads, n, [&](unsigned, const std::size_t first, const std::size_t last) {
+        std::sort(items.begin() + static_cast<std::ptrdiff_t>(first), items.begin() + static_cast<std::ptrdiff_t>(last),
+                  before);
+    });
+
+    // Merges pairs of sorted runs, one thread per pair, doubling the run length each round
+    std::vector<Item> buffer(n);
+    for (std::size_t width = blockSize; width < n; width *= 2)
+    {
+        const std::size_t pairs = (n + 2 * width - 1) / (2 * width);
+
+        const auto mergePair = [&](const unsigned pair, std::size_t, std::size_t) {
+            const auto begin = items.begin();
+            const std::size_t first = std::size_t{pair} * 2 * width;
+            const std::size_t middle = std::min(n, first + width);
+            const std::size_t last = std::min(n, first + 2 * width);
+
+            std::merge(begin + static_cast<std::ptrdiff_t>(first), begin + static_cast<std::ptrdiff_t>(middle),
+                       begin + static_cast<std::ptrdiff_t>(middle), begin + static_cast<std::ptrdiff_t>(last),
+                       buffer.begin() + static_cast<std::ptrdiff_t>(first), before);
+        };
+        ParallelBlocks::forEach(static_cast<unsigned>(pairs), pairs, mergePair);
+        items.swap(buffer);
+    }
+}
+
+std::vector<std::uint32_t> FigureSorter::order(const FigureStore &store, const Key key, const bool descending,
+                                               unsigned threads, const Algorithm algorithm)
+{
+    if (threads == 0)
+    {
+        throw std::invalid_argument("Number of threads must be greater than 0");
+    }
+
+    std::vector<Item> items = extract(store, key, descending);
+    if (items.size() < PARALLEL_THRESHOLD)
+    {
+        threads = 1;
+    }
+
+    if (algorithm == RADIX)
+    {
+        radixSort(items, threads);
+    }
+    else
+    {
+        mergeSort(items, threads);
+    }
+
+    std::vector<std::uint32_t> numbers;
+    numbers.reserve(items.size());
+    for (const Item &item : items)
+    {
+        numbers.push_back(item.number);
+    }
+
+    return numbers;
+}
+
+void FigureSorter::sort(FigureStore &store, const Key key, const bool descending, const unsigned threads,
+                        const Algorithm algorithm)
+{
+    store.reorder(order(store, key, descending, threads, algorithm));
+}
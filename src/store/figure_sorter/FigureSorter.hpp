@@ -0,0 +1,68 @@
+#ifndef FIGURES_FIGURESORTER_HPP
+#define FIGURES_FIGURESORTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include "../figure_store/FigureStore.hpp"
+
+// Sorts a store by figure type, perimeter or one dimension. The keys are read once into a contiguous array and
+// sorted there, either by an LSD radix sort on their IEEE-754 bit patterns or by a merge sort, both stable and
+// spread over several threads; the store is then permuted once. Figures that lack the sorted dimension come last,
+// and figures with equal keys keep their relative order. Plugin figures sort after the built-in types and lack
+// every dimension.
+class FigureSorter
+{
+  public:
+    enum Key : std::uint8_t
+    {
+        TYPE = 0,
+        PERIMETER,
+        SIDE_A,
+        SIDE_B,
+        SIDE_C,
+        RADIUS,
+        WIDTH,
+        HEIGHT
+    };
+
+    enum Algorithm : std::uint8_t
+    {
+        RADIX = 0,
+        MERGE
+    };
+
+    static constexpr std::string_view KEYS = "type, perimeter, a, b, c, radius, width, height";
+
+  private:
+    static constexpr std::size_t PARALLEL_THRESHOLD = 1 << 16;
+    static constexpr unsigned RADIX_BITS = 8;
+    static constexpr std::size_t BUCKETS = std::size_t{1} << RADIX_BITS;
+
+    struct Item
+    {
+        std::uint64_t key;
+        std::uint32_t number;
+    };
+
+    static std::uint64_t encode(double value, bool descending);
+    static std::vector<Item> extract(const FigureStore &store, Key key, bool descending);
+    static void radixSort(std::vector<Item> &items, unsigned threads);
+    static void mergeSort(std::vector<Item> &items, unsigned threads);
+
+  public:
+    static Key parseKey(std::string_view name);
+
+    // The numbers of the figures in sorted order
+    static std::vector<std::uint32_t> order(const FigureStore &store, Key key, bool descending = false,
+                                            unsigned threads = 1, Algorithm algorithm = RADIX);
+
+    // Sorts the figures in place; like compact(), this renumbers them
+    static void sort(FigureStore &store, Key key, bool descending = false, unsigned threads = 1,
+                     Algorithm algorithm = RADIX);
+};
+
+#endif // FIGURES_FIGURESORTER_HPP
@@ -0,0 +1,813 @@
+#include "FigureStore.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+#include "../../util/figure_hash/FigureHash.hpp"
+#include "../../util/figure_registry/FigureRegistry.hpp"
+#include "../../util/perimeter_kernel/PerimeterKernel.hpp"
+
+namespace
+{
+// Gathers plugin figures of one type into parameter columns, so its plugin measures them in one call
+class PluginBatch
+{
+  private:
+    std::array<std::vector<double>, FIGURES_PLUGIN_MAX_PARAMS> columns;
+    std::size_t count = 0;
+
+  public:
+    std::size_t size() const
+    {
+        return count;
+    }
+
+    void add(const std::span<const double> params)
+    {
+        for (std::size_t p = 0; p < params.size(); p++)
+        {
+            columns[p].push_back(params[p]);
+        }
+        count++;
+    }
+
+    void flush(const PluginRegistry &registry, const PluginRegistry::TypeId id, FigureAggregates &aggregates,
+               const std::span<double> buffer)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        const unsigned paramCount = registry.params(id);
+        std::array<std::span<const double>, FIGURES_PLUGIN_MAX_PARAMS> spans{};
+        for (unsigned p = 0; p < paramCount; p++)
+        {
+            spans[p] = columns[p];
+        }
+
+        registry.perimeters(id, std::span(spans).first(paramCount), buffer.first(count));
+        aggregates.accumulate(buffer.first(count));
+
+        for (std::vector<double> &column : columns)
+        {
+            column.clear();
+        }
+        count = 0;
+    }
+};
+} // namespace
+
+std::size_t FigureStore::heapFootprint(const std::size_t objectSize)
+{
+    constexpr std::size_t header = sizeof(std::size_t);
+    constexpr std::size_t alignment = 2 * sizeof(std::size_t);
+    constexpr std::size_t minChunk = 4 * sizeof(std::size_t);
+
+    const std::size_t chunk = (objectSize + header + alignment - 1) / alignment * alignment;
+    return std::max(chunk, minChunk);
+}
+
+std::size_t FigureStore::columnSize(const std::uint8_t type) const
+{
+    switch (type)
+    {
+    case FigureUtil::TRIANGLE:
+        return triangleA.size();
+    case FigureUtil::CIRCLE:
+        return circleRadius.size();
+    case FigureUtil::RECTANGLE:
+        return rectangleWidth.size();
+    case PLUGIN:
+        return pluginFigures.size();
+    }
+
+    return 0;
+}
+
+std::vector<std::uint32_t> &FigureStore::rowSlots(const std::uint8_t type)
+{
+    switch (type)
+    {
+    case FigureUtil::TRIANGLE:
+        return triangleSlots;
+    case FigureUtil::CIRCLE:
+        return circleSlots;
+    case PLUGIN:
+        return pluginSlots;
+    }
+
+    return rectangleSlots;
+}
+
+void FigureStore::moveRow(const std::uint8_t type, const std::uint32_t from, const std::uint32_t to)
+{
+    switch (type)
+    {
+    case FigureUtil::TRIANGLE:
+        triangleA[to] = triangleA[from];
+        triangleB[to] = triangleB[from];
+        triangleC[to] = triangleC[from];
+        break;
+    case FigureUtil::CIRCLE:
+        circleRadius[to] = circleRadius[from];
+        break;
+    case FigureUtil::RECTANGLE:
+        rectangleWidth[to] = rectangleWidth[from];
+        rectangleHeight[to] = rectangleHeight[from];
+        break;
+    case PLUGIN:
+        pluginFigures[to] = pluginFigures[from];
+        break;
+    }
+}
+
+void FigureStore::popRow(const std::uint8_t type)
+{
+    switch (type)
+    {
+    case FigureUtil::TRIANGLE:
+        triangleA.pop_back();
+        triangleB.pop_back();
+        triangleC.pop_back();
+        break;
+    case FigureUtil::CIRCLE:
+        circleRadius.pop_back();
+        break;
+    case FigureUtil::RECTANGLE:
+        rectangleWidth.pop_back();
+        rectangleHeight.pop_back();
+        break;
+    case PLUGIN:
+        pluginFigures.pop_back();
+        break;
+    }
+
+    rowSlots(type).pop_back();
+}
+
+void FigureStore::pushEntry(const std::uint8_t type, const std::uint32_t row)
+{
+    rowSlots(type).push_back(static_cast<std::uint32_t>(entries.size()));
+    entries.push_back({row, type});
+    generations.push_back(nextGeneration++);
+    figureCount++;
+}
+
+const FigureStore::Entry &FigureStore::liveEntry(const std::size_t index) const
+{
+    if (index >= entries.size() || entries[index].type == VACANT)
+    {
+        throw std::out_of_range("No figure at index " + std::to_string(index));
+    }
+
+    return entries[index];
+}
+
+double FigureStore::rowPerimeter(const Entry entry) const
+{
+    switch (entry.type)
+    {
+    case FigureUtil::TRIANGLE:
+        return triangleA[entry.row] + triangleB[entry.row] + triangleC[entry.row];
+    case FigureUtil::CIRCLE:
+        return 2 * M_PI * circleRadius[entry.row];
+    case FigureUtil::RECTANGLE:
+        return 2 * rectangleWidth[entry.row] + 2 * rectangleHeight[entry.row];
+    case PLUGIN:
+        return pluginFigures[entry.row].perimeter();
+    }
+
+    return 0;
+}
+
+std::span<const double> FigureStore::rowParams(const Entry entry,
+                                               const std::span<double, FigureUtil::MAX_FIGURE_PARAMS> params) const
+{
+    switch (entry.type)
+    {
+    case FigureUtil::TRIANGLE:
+        params[0] = triangleA[entry.row];
+        params[1] = triangleB[entry.row];
+        params[2] = triangleC[entry.row];
+        return params.first(3);
+    case FigureUtil::CIRCLE:
+        params[0] = circleRadius[entry.row];
+        return params.first(1);
+    case FigureUtil::RECTANGLE:
+        params[0] = rectangleWidth[entry.row];
+        params[1] = rectangleHeight[entry.row];
+        return params.first(2);
+    case PLUGIN:
+        return pluginFigures[entry.row].getParams();
+    }
+
+    return {};
+}
+
+void FigureStore::countLastEntry()
+{
+    const Entry entry = entries.back();
+    if (entry.type == PLUGIN)
+    {
+        aggregates.addPlugin(rowPerimeter(entry));
+        return;
+    }
+    aggregates.add(static_cast<FigureUtil::FigureType>(entry.type), rowPerimeter(entry));
+}
+
+std::size_t FigureStore::size() const
+{
+    return figureCount;
+}
+
+std::size_t FigureStore::slotCount() const
+{
+    return entries.size();
+}
+
+bool FigureStore::empty() const
+{
+    return figureCount == 0;
+}
+
+bool FigureStore::contains(const std::size_t index) const
+{
+    return index < entries.size() && entries[index].type != VACANT;
+}
+
+bool FigureStore::contains(const Handle handle) const
+{
+    return contains(handle.slot) && generations[handle.slot] == handle.generation;
+}
+
+void FigureStore::reserve(const std::size_t n)
+{
+    entries.reserve(n);
+    generations.reserve(n);
+}
+
+void FigureStore::clear()
+{
+    triangleA.clear();
+    triangleB.clear();
+    triangleC.clear();
+    circleRadius.clear();
+    rectangleWidth.clear();
+    rectangleHeight.clear();
+    triangleSlots.clear();
+    circleSlots.clear();
+    rectangleSlots.clear();
+    pluginFigures.clear();
+    pluginSlots.clear();
+    entries.clear();
+    generations.clear();
+    figureCount = 0;
+    aggregates.clear();
+}
+
+void FigureStore::add(const Figure &figure)
+{
+    if (const auto *plugin = dynamic_cast<const PluginFigure *>(&figure))
+    {
+        add(*plugin);
+        return;
+    }
+
+    FigureRegistry::visit(figure.getType(), [this, &figure]<typename T>() { add(static_cast<const T &>(figure)); });
+}
+
+void FigureStore::add(const Triangle &triangle)
+{
+    pushEntry(FigureUtil::TRIANGLE, static_cast<std::uint32_t>(triangleA.size()));
+    triangleA.push_back(triangle.getA());
+    triangleB.push_back(triangle.getB());
+    triangleC.push_back(triangle.getC());
+    countLastEntry();
+}
+
+void FigureStore::add(const Circle &circle)
+{
+    pushEntry(FigureUtil::CIRCLE, static_cast<std::uint32_t>(circleRadius.size()));
+    circleRadius.push_back(circle.getRadius());
+    countLastEntry();
+}
+
+void FigureStore::add(const Rectangle &rectangle)
+{
+    pushEntry(FigureUtil::RECTANGLE, static_cast<std::uint32_t>(rectangleWidth.size()));
+    rectangleWidth.push_back(rectangle.getWidth());
+    rectangleHeight.push_back(rectangle.getHeight());
+    countLastEntry();
+}
+
+void FigureStore::add(const PluginFigure &figure)
+{
+    pushEntry(PLUGIN, static_cast<std::uint32_t>(pluginFigures.size()));
+    pluginFigures.push_back(figure);
+    countLastEntry();
+}
+
+void FigureStore::append(const FigureStore &other)
+{
+    if (other.figureCount != other.entries.size())
+    {
+        append(other, 0, other.entries.size());
+        return;
+    }
+
+    const auto triangleOffset = static_cast<std::uint32_t>(triangleA.size());
+    const auto circleOffset = static_cast<std::uint32_t>(circleRadius.size());
+    const auto rectangleOffset = static_cast<std::uint32_t>(rectangleWidth.size());
+    const auto pluginOffset = static_cast<std::uint32_t>(pluginFigures.size());
+
+    triangleSlots.resize(triangleOffset + other.triangleA.size());
+    circleSlots.resize(circleOffset + other.circleRadius.size());
+    rectangleSlots.resize(rectangleOffset + other.rectangleWidth.size());
+    pluginSlots.resize(pluginOffset + other.pluginFigures.size());
+
+    entries.reserve(entries.size() + other.entries.size());
+    generations.reserve(generations.size() + other.entries.size());
+    for (const Entry entry : other.entries)
+    {
+        const auto slot = static_cast<std::uint32_t>(entries.size());
+
+        switch (entry.type)
+        {
+        case FigureUtil::TRIANGLE:
+            entries.push_back({entry.row + triangleOffset, entry.type});
+            triangleSlots[entry.row + triangleOffset] = slot;
+            break;
+        case FigureUtil::CIRCLE:
+            entries.push_back({entry.row + circleOffset, entry.type});
+            circleSlots[entry.row + circleOffset] = slot;
+            break;
+        case FigureUtil::RECTANGLE:
+            entries.push_back({entry.row + rectangleOffset, entry.type});
+            rectangleSlots[entry.row + rectangleOffset] = slot;
+            break;
+        case PLUGIN:
+            entries.push_back({entry.row + pluginOffset, entry.type});
+            pluginSlots[entry.row + pluginOffset] = slot;
+            break;
+        }
+        generations.push_back(nextGeneration++);
+    }
+    figureCount += other.figureCount;
+    aggregates.merge(other.getAggregates());
+
+    triangleA.insert(triangleA.end(), other.triangleA.begin(), other.triangleA.end());
+    triangleB.insert(triangleB.end(), other.triangleB.begin(), other.triangleB.end());
+    triangleC.insert(triangleC.end(), other.triangleC.begin(), other.triangleC.end());
+    circleRadius.insert(circleRadius.end(), other.circleRadius.begin(), other.circleRadius.end());
+    rectangleWidth.insert(rectangleWidth.end(), other.rectangleWidth.begin(), other.rectangleWidth.end());
+    rectangleHeight.insert(rectangleHeight.end(), other.rectangleHeight.begin(), other.rectangleHeight.end());
+    pluginFigures.insert(pluginFigures.end(), other.pluginFigures.begin(), other.pluginFigures.end());
+}
+
+void FigureStore::append(const FigureStore &other, const std::size_t first, const std::size_t count)
+{
+    if (first > other.slotCount() || count > other.slotCount() - first)
+    {
+        throw std::out_of_range("Figure range exceeds the source store");
+    }
+
+    if (first == 0 && count == other.slotCount() && other.figureCount == count)
+    {
+        append(other);
+        return;
+    }
+
+    entries.reserve(entries.size() + count);
+    for (std::size_t i = first; i < first + count; i++)
+    {
+        const Entry entry = other.entries[i];
+
+        switch (entry.type)
+        {
+        case FigureUtil::TRIANGLE:
+            pushEntry(FigureUtil::TRIANGLE, static_cast<std::uint32_t>(triangleA.size()));
+            triangleA.push_back(other.triangleA[entry.row]);
+            triangleB.push_back(other.triangleB[entry.row]);
+            triangleC.push_back(other.triangleC[entry.row]);
+            break;
+        case FigureUtil::CIRCLE:
+            pushEntry(FigureUtil::CIRCLE, static_cast<std::uint32_t>(circleRadius.size()));
+            circleRadius.push_back(other.circleRadius[entry.row]);
+            break;
+        case FigureUtil::RECTANGLE:
+            pushEntry(FigureUtil::RECTANGLE, static_cast<std::uint32_t>(rectangleWidth.size()));
+            rectangleWidth.push_back(other.rectangleWidth[entry.row]);
+            rectangleHeight.push_back(other.rectangleHeight[entry.row]);
+            break;
+        case PLUGIN:
+            pushEntry(PLUGIN, static_cast<std::uint32_t>(pluginFigures.size()));
+            pluginFigures.push_back(other.pluginFigures[entry.row]);
+            break;
+        }
+
+        if (entry.type != VACANT)
+        {
+            countLastEntry();
+        }
+    }
+}
+
+FigureUtil::FigureType FigureStore::typeAt(const std::size_t index) const
+{
+    const Entry entry = liveEntry(index);
+    if (entry.type == PLUGIN)
+    {
+        return pluginFigures[entry.row].getType();
+    }
+
+    return static_cast<FigureUtil::FigureType>(entry.type);
+}
+
+std::unique_ptr<Figure> FigureStore::at(const std::size_t index) const
+{
+    const Entry entry = liveEntry(index);
+
+    switch (entry.type)
+    {
+    case FigureUtil::TRIANGLE:
+        return std::make_unique<Triangle>(triangleA[entry.row], triangleB[entry.row], triangleC[entry.row]);
+    case FigureUtil::CIRCLE:
+        return std::make_unique<Circle>(circleRadius[entry.row]);
+    case FigureUtil::RECTANGLE:
+        return std::make_unique<Rectangle>(rectangleWidth[entry.row], rectangleHeight[entry.row]);
+    case PLUGIN:
+        return std::make_unique<PluginFigure>(pluginFigures[entry.row]);
+    }
+
+    return nullptr;
+}
+
+double FigureStore::perimeterAt(const std::size_t index) const
+{
+    return rowPerimeter(liveEntry(index));
+}
+
+void FigureStore::formatTo(const std::size_t index, std::string &out) const
+{
+    const Entry entry = liveEntry(index);
+
+    switch (entry.type)
+    {
+    case FigureUtil::TRIANGLE:
+        Triangle(triangleA[entry.row], triangleB[entry.row], triangleC[entry.row]).formatTo(out);
+        break;
+    case FigureUtil::CIRCLE:
+        Circle(circleRadius[entry.row]).formatTo(out);
+        break;
+    case FigureUtil::RECTANGLE:
+        Rectangle(rectangleWidth[entry.row], rectangleHeight[entry.row]).formatTo(out);
+        break;
+    case PLUGIN:
+        pluginFigures[entry.row].formatTo(out);
+        break;
+    }
+}
+
+std::uint64_t FigureStore::hashAt(const std::size_t index) const
+{
+    const Entry entry = liveEntry(index);
+    if (entry.type == PLUGIN)
+    {
+        const PluginFigure &figure = pluginFigures[entry.row];
+        return FigureHash::hashPlugin(figure.getRegistry().name(figure.getTypeId()), figure.getParams());
+    }
+
+    std::array<double, FigureUtil::MAX_FIGURE_PARAMS> params{};
+    return FigureHash::hash(static_cast<FigureUtil::FigureType>(entry.type), rowParams(entry, params));
+}
+
+bool FigureStore::equalAt(const std::size_t left, const std::size_t right) const
+{
+    const Entry leftEntry = liveEntry(left);
+    const Entry rightEntry = liveEntry(right);
+    if (leftEntry.type != rightEntry.type)
+    {
+        return false;
+    }
+
+    if (leftEntry.type == PLUGIN)
+    {
+        const PluginFigure &leftFigure = pluginFigures[leftEntry.row];
+        const PluginFigure &rightFigure = pluginFigures[rightEntry.row];
+        return &leftFigure.getRegistry() == &rightFigure.getRegistry() &&
+               leftFigure.getTypeId() == rightFigure.getTypeId() &&
+               std::ranges::equal(leftFigure.getParams(), rightFigure.getParams());
+    }
+
+    std::array<double, FigureUtil::MAX_FIGURE_PARAMS> leftParams{};
+    std::array<double, FigureUtil::MAX_FIGURE_PARAMS> rightParams{};
+    return std::ranges::equal(rowParams(leftEntry, leftParams), rowParams(rightEntry, rightParams));
+}
+
+FigureStore::Handle FigureStore::clone(const std::size_t index)
+{
+    const Entry entry = liveEntry(index);
+
+    switch (entry.type)
+    {
+    case FigureUtil::TRIANGLE:
+        pushEntry(FigureUtil::TRIANGLE, static_cast<std::uint32_t>(triangleA.size()));
+        triangleA.push_back(triangleA[entry.row]);
+        triangleB.push_back(triangleB[entry.row]);
+        triangleC.push_back(triangleC[entry.row]);
+        break;
+    case FigureUtil::CIRCLE:
+        pushEntry(FigureUtil::CIRCLE, static_cast<std::uint32_t>(circleRadius.size()));
+        circleRadius.push_back(circleRadius[entry.row]);
+        break;
+    case FigureUtil::RECTANGLE:
+        pushEntry(FigureUtil::RECTANGLE, static_cast<std::uint32_t>(rectangleWidth.size()));
+        rectangleWidth.push_back(rectangleWidth[entry.row]);
+        rectangleHeight.push_back(rectangleHeight[entry.row]);
+        break;
+    case PLUGIN:
+        pushEntry(PLUGIN, static_cast<std::uint32_t>(pluginFigures.size()));
+        pluginFigures.push_back(pluginFigures[entry.row]);
+        break;
+    }
+    countLastEntry();
+
+    return handleAt(entries.size() - 1);
+}
+
+void FigureStore::remove(const std::size_t index)
+{
+    const Entry removed = liveEntry(index);
+    const std::uint8_t type = removed.type;
+    const auto lastRow = static_cast<std::uint32_t>(columnSize(type) - 1);
+
+    if (type == PLUGIN)
+    {
+        aggregates.removePlugin(rowPerimeter(removed));
+    }
+    else
+    {
+        aggregates.remove(static_cast<FigureUtil::FigureType>(type), rowPerimeter(removed));
+    }
+
+    if (removed.row != lastRow)
+    {
+        std::vector<std::uint32_t> &slots = rowSlots(type);
+
+        moveRow(type, lastRow, removed.row);
+        slots[removed.row] = slots[lastRow];
+        entries[slots[removed.row]].row = removed.row;
+    }
+
+    popRow(type);
+    entries[index] = {0, VACANT};
+    generations[index] = nextGeneration++;
+    figureCount--;
+}
+
+void FigureStore::compact()
+{
+    std::size_t next = 0;
+    for (std::size_t slot = 0; slot < entries.size(); slot++)
+    {
+        const Entry entry = entries[slot];
+        if (entry.type == VACANT)
+        {
+            continue;
+        }
+
+        if (slot != next)
+        {
+            entries[next] = entry;
+            rowSlots(entry.type)[entry.row] = static_cast<std::uint32_t>(next);
+            generations[next] = nextGeneration++;
+        }
+        next++;
+    }
+
+    entries.resize(next);
+    generations.resize(next);
+}
+
+void FigureStore::reorder(const std::span<const std::uint32_t> order)
+{
+    if (order.size() != figureCount)
+    {
+        throw std::invalid_argument("Order must name every figure exactly once");
+    }
+
+    FigureStore sorted;
+    sorted.nextGeneration = nextGeneration;
+    sorted.triangleA.reserve(triangleA.size());
+    sorted.triangleB.reserve(triangleB.size());
+    sorted.triangleC.reserve(triangleC.size());
+    sorted.circleRadius.reserve(circleRadius.size());
+    sorted.rectangleWidth.reserve(rectangleWidth.size());
+    sorted.rectangleHeight.reserve(rectangleHeight.size());
+    sorted.pluginFigures.reserve(pluginFigures.size());
+    sorted.triangleSlots.reserve(triangleSlots.size());
+    sorted.circleSlots.reserve(circleSlots.size());
+    sorted.rectangleSlots.reserve(rectangleSlots.size());
+    sorted.pluginSlots.reserve(pluginSlots.size());
+    sorted.reserve(figureCount);
+
+    std::vector<bool> seen(entries.size());
+    for (const std::uint32_t slot : order)
+    {
+        if (!contains(slot) || seen[slot])
+        {
+            throw std::invalid_argument("Order must name every figure exactly once");
+        }
+        seen[slot] = true;
+
+        const Entry entry = entries[slot];
+        switch (entry.type)
+        {
+        case FigureUtil::TRIANGLE:
+            sorted.pushEntry(FigureUtil::TRIANGLE, static_cast<std::uint32_t>(sorted.triangleA.size()));
+            sorted.triangleA.push_back(triangleA[entry.row]);
+            sorted.triangleB.push_back(triangleB[entry.row]);
+            sorted.triangleC.push_back(triangleC[entry.row]);
+            break;
+        case FigureUtil::CIRCLE:
+            sorted.pushEntry(FigureUtil::CIRCLE, static_cast<std::uint32_t>(sorted.circleRadius.size()));
+            sorted.circleRadius.push_back(circleRadius[entry.row]);
+            break;
+        case FigureUtil::RECTANGLE:
+            sorted.pushEntry(FigureUtil::RECTANGLE, static_cast<std::uint32_t>(sorted.rectangleWidth.size()));
+            sorted.rectangleWidth.push_back(rectangleWidth[entry.row]);
+            sorted.rectangleHeight.push_back(rectangleHeight[entry.row]);
+            break;
+        case PLUGIN:
+            sorted.pushEntry(PLUGIN, static_cast<std::uint32_t>(sorted.pluginFigures.size()));
+            sorted.pluginFigures.push_back(pluginFigures[entry.row]);
+            break;
+        }
+    }
+
+    // The same figures, so the aggregates carry over unchanged
+    sorted.aggregates = aggregates;
+    *this = std::move(sorted);
+}
+
+FigureStore::Handle FigureStore::handleAt(const std::size_t index) const
+{
+    liveEntry(index);
+    return {static_cast<std::uint32_t>(index), generations[index]};
+}
+
+std::size_t FigureStore::indexOf(const Handle handle) const
+{
+    if (!contains(handle))
+    {
+        throw std::out_of_range("Stale figure handle");
+    }
+
+    return handle.slot;
+}
+
+std::span<const double> FigureStore::getTriangleA() const
+{
+    return triangleA;
+}
+
+std::span<const double> FigureStore::getTriangleB() const
+{
+    return triangleB;
+}
+
+std::span<const double> FigureStore::getTriangleC() const
+{
+    return triangleC;
+}
+
+std::span<const double> FigureStore::getCircleRadius() const
+{
+    return circleRadius;
+}
+
+std::span<const double> FigureStore::getRectangleWidth() const
+{
+    return rectangleWidth;
+}
+
+std::span<const double> FigureStore::getRectangleHeight() const
+{
+    return rectangleHeight;
+}
+
+std::span<const double> FigureStore::getColumn(const FigureUtil::FigureType type, const unsigned param) const
+{
+    switch (type)
+    {
+    case FigureUtil::TRIANGLE:
+        return param == 0 ? triangleA : param == 1 ? triangleB : triangleC;
+    case FigureUtil::CIRCLE:
+        return circleRadius;
+    case FigureUtil::RECTANGLE:
+        return param == 0 ? rectangleWidth : rectangleHeight;
+    }
+
+    return {};
+}
+
+std::span<const PluginFigure> FigureStore::getPluginFigures() const
+{
+    return pluginFigures;
+}
+
+std::span<const FigureStore::Entry> FigureStore::getEntries() const
+{
+    return entries;
+}
+
+const FigureAggregates &FigureStore::getAggregates() const
+{
+    if (!aggregates.isStale())
+    {
+        return aggregates;
+    }
+
+    constexpr std::size_t chunkSize = 4096;
+    std::array<double, chunkSize> buffer{};
+
+    aggregates.resetPerimeters();
+
+    for (std::size_t offset = 0; offset < triangleA.size(); offset += chunkSize)
+    {
+        const std::size_t n = std::min(chunkSize, triangleA.size() - offset);
+        aggregates.accumulate(PerimeterKernel::triangles(getTriangleA().subspan(offset, n),
+                                                         getTriangleB().subspan(offset, n),
+                                                         getTriangleC().subspan(offset, n), buffer));
+    }
+
+    for (std::size_t offset = 0; offset < circleRadius.size(); offset += chunkSize)
+    {
+        const std::size_t n = std::min(chunkSize, circleRadius.size() - offset);
+        aggregates.accumulate(PerimeterKernel::circles(getCircleRadius().subspan(offset, n), buffer));
+    }
+
+    for (std::size_t offset = 0; offset < rectangleWidth.size(); offset += chunkSize)
+    {
+        const std::size_t n = std::min(chunkSize, rectangleWidth.size() - offset);
+        aggregates.accumulate(PerimeterKernel::rectangles(getRectangleWidth().subspan(offset, n),
+                                                          getRectangleHeight().subspan(offset, n), buffer));
+    }
+
+    // Plugin figures go through their plugin's batch kernel one type at a time
+    const PluginRegistry *registry = pluginFigures.empty() ? nullptr : &pluginFigures.front().getRegistry();
+    std::vector<PluginBatch> batches(registry != nullptr ? registry->size() : 0);
+    for (const PluginFigure &figure : pluginFigures)
+    {
+        if (&figure.getRegistry() != registry)
+        {
+            const double perimeter = figure.perimeter();
+            aggregates.accumulate(std::span(&perimeter, 1));
+            continue;
+        }
+
+        PluginBatch &batch = batches[figure.getTypeId()];
+        batch.add(figure.getParams());
+        if (batch.size() == chunkSize)
+        {
+            batch.flush(*registry, figure.getTypeId(), aggregates, buffer);
+        }
+    }
+
+    for (PluginRegistry::TypeId id = 0; id < batches.size(); id++)
+    {
+        batches[id].flush(*registry, id, aggregates, buffer);
+    }
+
+    return aggregates;
+}
+
+FigureStore::MemoryReport FigureStore::memoryReport() const
+{
+    MemoryReport report{};
+    report.figureCount = figureCount;
+
+    report.storeBytes = entries.capacity() * sizeof(Entry) + generations.capacity() * sizeof(std::uint32_t);
+    for (const std::vector<double> *column :
+         {&triangleA, &triangleB, &triangleC, &circleRadius, &rectangleWidth, &rectangleHeight})
+    {
+        report.storeBytes += column->capacity() * sizeof(double);
+    }
+    for (const std::vector<std::uint32_t> *slots : {&triangleSlots, &circleSlots, &rectangleSlots, &pluginSlots})
+    {
+        report.storeBytes += slots->capacity() * sizeof(std::uint32_t);
+    }
+    report.storeBytes += pluginFigures.capacity() * sizeof(PluginFigure);
+
+    report.pointerLayoutBytes = figureCount * sizeof(std::unique_ptr<Figure>);
+    report.pointerLayoutBytes += triangleA.size() * heapFootprint(sizeof(Triangle));
+    report.pointerLayoutBytes += circleRadius.size() * heapFootprint(sizeof(Circle));
+    report.pointerLayoutBytes += rectangleWidth.size() * heapFootprint(sizeof(Rectangle));
+    report.pointerLayoutBytes += pluginFigures.size() * heapFootprint(sizeof(PluginFigure));
+
+    return report;
+}
@@ -0,0 +1,134 @@
+#ifndef FIGURES_FIGURESTORE_HPP
+#define FIGURES_FIGURESTORE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "../../figure/Figure.hpp"
+#include "../../figure/circle/Circle.hpp"
+#include "../../figure/plugin_figure/PluginFigure.hpp"
+#include "../../figure/rectangle/Rectangle.hpp"
+#include "../../figure/triangle/Triangle.hpp"
+#include "../../util/figure_util/FigureUtil.hpp"
+#include "../figure_aggregates/FigureAggregates.hpp"
+
+// Figures live in numbered slots kept in insertion order. Removing a figure leaves its slot vacant, so the other
+// figures keep their numbers and removal is O(1); compact() drops the vacant slots and renumbers the figures.
+// Plugin figures have no columns of their own and are kept whole, with entry type PLUGIN
+class FigureStore
+{
+  public:
+    static constexpr std::uint8_t PLUGIN = FigureUtil::FIGURE_NUM;
+    static constexpr std::uint8_t VACANT = 0xFF;
+
+    struct Entry
+    {
+        std::uint32_t row;
+        std::uint8_t type;
+    };
+
+    // A slot plus the generation of the figure in it, so a handle kept across removals and compaction is detected
+    // as stale instead of naming another figure
+    struct Handle
+    {
+        std::uint32_t slot;
+        std::uint32_t generation;
+    };
+
+    struct MemoryReport
+    {
+        std::size_t figureCount;
+        std::size_t storeBytes;
+        std::size_t pointerLayoutBytes;
+    };
+
+  private:
+    std::vector<double> triangleA;
+    std::vector<double> triangleB;
+    std::vector<double> triangleC;
+    std::vector<double> circleRadius;
+    std::vector<double> rectangleWidth;
+    std::vector<double> rectangleHeight;
+    std::vector<PluginFigure> pluginFigures;
+
+    // The slot of each row, so a removal can move the last row into the gap in O(1)
+    std::vector<std::uint32_t> triangleSlots;
+    std::vector<std::uint32_t> circleSlots;
+    std::vector<std::uint32_t> rectangleSlots;
+    std::vector<std::uint32_t> pluginSlots;
+
+    std::vector<Entry> entries;
+    std::vector<std::uint32_t> generations;
+    std::size_t figureCount = 0;
+    std::uint32_t nextGeneration = 0;
+    // Rescanned by getAggregates() when a removal leaves the perimeter minimum or maximum stale
+    mutable FigureAggregates aggregates;
+
+    static std::size_t heapFootprint(std::size_t objectSize);
+
+    std::size_t columnSize(std::uint8_t type) const;
+    std::vector<std::uint32_t> &rowSlots(std::uint8_t type);
+    void moveRow(std::uint8_t type, std::uint32_t from, std::uint32_t to);
+    void popRow(std::uint8_t type);
+    void pushEntry(std::uint8_t type, std::uint32_t row);
+    const Entry &liveEntry(std::size_t index) const;
+    double rowPerimeter(Entry entry) const;
+    std::span<const double> rowParams(Entry entry, std::span<double, FigureUtil::MAX_FIGURE_PARAMS> params) const;
+    void countLastEntry();
+
+  public:
+    std::size_t size() const;
+    std::size_t slotCount() const;
+    bool empty() const;
+    bool contains(std::size_t index) const;
+    bool contains(Handle handle) const;
+    void reserve(std::size_t n);
+    void clear();
+
+    void add(const Figure &figure);
+    void add(const Triangle &triangle);
+    void add(const Circle &circle);
+    void add(const Rectangle &rectangle);
+    void add(const PluginFigure &figure);
+    void append(const FigureStore &other);
+    void append(const FigureStore &other, std::size_t first, std::size_t count);
+
+    // Throws std::logic_error for a plugin figure, which has no FigureType
+    FigureUtil::FigureType typeAt(std::size_t index) const;
+    std::unique_ptr<Figure> at(std::size_t index) const;
+    double perimeterAt(std::size_t index) const;
+    void formatTo(std::size_t index, std::string &out) const;
+    // FigureHash::hash of the figure, and whether two figures have the same type and parameters
+    std::uint64_t hashAt(std::size_t index) const;
+    bool equalAt(std::size_t left, std::size_t right) const;
+
+    Handle handleAt(std::size_t index) const;
+    std::size_t indexOf(Handle handle) const;
+
+    Handle clone(std::size_t index);
+    void remove(std::size_t index);
+    void compact();
+    // Renumbers the figures so figure i is the one numbered order[i] before; order must name every figure once
+    void reorder(std::span<const std::uint32_t> order);
+
+    std::span<const double> getTriangleA() const;
+    std::span<const double> getTriangleB() const;
+    std::span<const double> getTriangleC() const;
+    std::span<const double> getCircleRadius() const;
+    std::span<const double> getRectangleWidth() const;
+    std::span<const double> getRectangleHeight() const;
+    std::span<const double> getColumn(FigureUtil::FigureType type, unsigned param) const;
+    std::span<const PluginFigure> getPluginFigures() const;
+    // One entry per slot, with type VACANT for removed figures
+    std::span<const Entry> getEntries() const;
+    // Not safe to call concurrently with other calls to it, since it may rescan the perimeters
+    const FigureAggregates &getAggregates() const;
+
+    MemoryReport memoryReport() const;
+};
+
+#endif // FIGURES_FIGURESTORE_HPP
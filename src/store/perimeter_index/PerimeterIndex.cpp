@@ -0,0 +1,274 @@
+#include "PerimeterIndex.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+bool PerimeterIndex::less(const Node &node, const double perimeter, const std::size_t number)
+{
+    return node.perimeter < perimeter || (node.perimeter == perimeter && node.number < number);
+}
+
+std::uint32_t PerimeterIndex::priorityOf(const std::uint32_t node)
+{
+    // Mixes the node position into a pseudo-random priority (the finaliser of splitmix64)
+    std::uint64_t x = node + 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return static_cast<std::uint32_t>(x ^ (x >> 31));
+}
+
+std::uint32_t PerimeterIndex::sizeOf(const std::uint32_t node) const
+{
+    return node == NIL ? 0 : nodes[node].size;
+}
+
+void PerimeterIndex::update(const std::uint32_t node)
+{
+    nodes[node].size = 1 + sizeOf(nodes[node].left) + sizeOf(nodes[node].right);
+}
+
+std::uint32_t PerimeterIndex::updateSizes(const std::uint32_t node)
+{
+    if (node == NIL)
+    {
+        return 0;
+    }
+
+    nodes[node].size = 1 + updateSizes(nodes[node].left) + updateSizes(nodes[node].right);
+    return nodes[node].size;
+}
+
+std::uint32_t PerimeterIndex::merge(const std::uint32_t left, const std::uint32_t right)
+{
+    if (left == NIL)
+    {
+        return right;
+    }
+    if (right == NIL)
+    {
+        return left;
+    }
+
+    if (nodes[left].priority > nodes[right].priority)
+    {
+        nodes[left].right = merge(nodes[left].right, right);
+        update(left);
+        return left;
+    }
+
+    nodes[right].left = merge(left, nodes[right].left);
+    update(right);
+    return right;
+}
+
+void PerimeterIndex::split(const std::uint32_t node, const double perimeter, const std::size_t number,
+                           std::uint32_t &left, std::uint32_t &right)
+{
+    if (node == NIL)
+    {
+        left = right = NIL;
+        return;
+    }
+
+    if (less(nodes[node], perimeter, number))
+    {
+        split(nodes[node].right, perimeter, number, nodes[node].right, right);
+        left = node;
+    }
+    else
+    {
+        split(nodes[node].left, perimeter, number, left, nodes[node].left);
+        right = node;
+    }
+    update(node);
+}
+
+std::uint32_t PerimeterIndex::allocate(const double perimeter, const std::size_t number)
+{
+    std::uint32_t node;
+    if (!freeNodes.empty())
+    {
+        node = freeNodes.back();
+        freeNodes.pop_back();
+    }
+    else
+    {
+        if (nodes.size() == NIL)
+        {
+            throw std::length_error("Perimeter index is full");
+        }
+        node = static_cast<std::uint32_t>(nodes.size());
+        nodes.emplace_back();
+    }
+
+    nodes[node] = Node{perimeter, static_cast<std::uint32_t>(number), priorityOf(node), NIL, NIL, 1};
+    return node;
+}
+
+void PerimeterIndex::build(const FigureStore &store)
+{
+    clear();
+    if (store.size() >= NIL)
+    {
+        throw std::length_error("Perimeter index is full");
+    }
+
+    nodes.reserve(store.size());
+    for (std::size_t i = 0; i < store.slotCount(); i++)
+    {
+        if (store.contains(i))
+        {
+            nodes.push_back(Node{store.perimeterAt(i), static_cast<std::uint32_t>(i), 0, NIL, NIL, 1});
+        }
+    }
+
+    std::ranges::sort(nodes, [](const Node &a, const Node &b) { return less(a, b.perimeter, b.number); });
+
+    // Nodes are in key order, so the treap is the Cartesian tree of their priorities, built with a stack of the
+    // rightmost path
+    std::vector<std::uint32_t> rightPath;
+    for (std::uint32_t node = 0; node < nodes.size(); node++)
+    {
+        nodes[node].priority = priorityOf(node);
+
+        std::uint32_t last = NIL;
+        while (!rightPath.empty() && nodes[rightPath.back()].priority < nodes[node].priority)
+        {
+            last = rightPath.back();
+            rightPath.pop_back();
+        }
+
+        nodes[node].left = last;
+        if (!rightPath.empty())
+        {
+            nodes[rightPath.back()].right = node;
+        }
+        rightPath.push_back(node);
+    }
+
+    root = rightPath.empty() ? NIL : rightPath.front();
+    updateSizes(root);
+}
+
+void PerimeterIndex::clear()
+{
+    nodes.clear();
+    freeNodes.clear();
+    root = NIL;
+}
+
+void PerimeterIndex::insert(const double perimeter, const std::size_t number)
+{
+    if (number >= NIL)
+    {
+        throw std::length_error("Perimeter index is full");
+    }
+
+    std::uint32_t left;
+    std::uint32_t right;
+    split(root, perimeter, number, left, right);
+    root = merge(merge(left, allocate(perimeter, number)), right);
+}
+
+bool PerimeterIndex::erase(const double perimeter, const std::size_t number)
+{
+    std::uint32_t left;
+    std::uint32_t rest;
+    split(root, perimeter, number, left, rest);
+
+    std::uint32_t match;
+    std::uint32_t right;
+    split(rest, perimeter, number + 1, match, right);
+
+    if (match != NIL)
+    {
+        freeNodes.push_back(match);
+    }
+    root = merge(left, right);
+
+    return match != NIL;
+}
+
+std::size_t PerimeterIndex::size() const
+{
+    return sizeOf(root);
+}
+
+bool PerimeterIndex::empty() const
+{
+    return root == NIL;
+}
+
+std::size_t PerimeterIndex::countBelow(const double perimeter) const
+{
+    std::size_t count = 0;
+    for (std::uint32_t node = root; node != NIL;)
+    {
+        if (nodes[node].perimeter < perimeter)
+        {
+            count += sizeOf(nodes[node].left) + 1;
+            node = nodes[node].right;
+        }
+        else
+        {
+            node = nodes[node].left;
+        }
+    }
+    return count;
+}
+
+std::size_t PerimeterIndex::countAtMost(const double perimeter) const
+{
+    std::size_t count = 0;
+    for (std::uint32_t node = root; node != NIL;)
+    {
+        if (nodes[node].perimeter <= perimeter)
+        {
+            count += sizeOf(nodes[node].left) + 1;
+            node = nodes[node].right;
+        }
+        else
+        {
+            node = nodes[node].left;
+        }
+    }
+    return count;
+}
+
+std::size_t PerimeterIndex::countInRange(const double minPerimeter, const double maxPerimeter) const
+{
+    if (minPerimeter > maxPerimeter)
+    {
+        return 0;
+    }
+
+    return countAtMost(maxPerimeter) - countBelow(minPerimeter);
+}
+
+PerimeterIndex::Key PerimeterIndex::kth(std::size_t k) const
+{
+    if (k >= size())
+    {
+        throw std::out_of_range("No figure at rank " + std::to_string(k));
+    }
+
+    std::uint32_t node = root;
+    while (true)
+    {
+        const std::size_t leftSize = sizeOf(nodes[node].left);
+        if (k < leftSize)
+        {
+            node = nodes[node].left;
+        }
+        else if (k == leftSize)
+        {
+            return Key{nodes[node].perimeter, nodes[node].number};
+        }
+        else
+        {
+            k -= leftSize + 1;
+            node = nodes[node].right;
+        }
+    }
+}
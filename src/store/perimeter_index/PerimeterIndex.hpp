@@ -0,0 +1,107 @@
+#ifndef FIGURES_PERIMETERINDEX_HPP
+#define FIGURES_PERIMETERINDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../figure_store/FigureStore.hpp"
+
+// Figure numbers ordered by perimeter in a treap whose nodes count their subtree, so inserting, erasing,
+// counting a perimeter range and finding the k-th smallest perimeter all take O(log n) expected time
+class PerimeterIndex
+{
+  public:
+    struct Key
+    {
+        double perimeter;
+        std::size_t number;
+    };
+
+  private:
+    static constexpr std::uint32_t NIL = UINT32_MAX;
+
+    struct Node
+    {
+        double perimeter;
+        std::uint32_t number;
+        std::uint32_t priority;
+        std::uint32_t left;
+        std::uint32_t right;
+        std::uint32_t size;
+    };
+
+    std::vector<Node> nodes;
+    std::vector<std::uint32_t> freeNodes;
+    std::uint32_t root = NIL;
+
+    static bool less(const Node &node, double perimeter, std::size_t number);
+    static std::uint32_t priorityOf(std::uint32_t node);
+
+    std::uint32_t sizeOf(std::uint32_t node) const;
+    void update(std::uint32_t node);
+    std::uint32_t updateSizes(std::uint32_t node);
+    std::uint32_t merge(std::uint32_t left, std::uint32_t right);
+    // Splits into the nodes ordered before (perimeter, number) and the rest
+    void split(std::uint32_t node, double perimeter, std::size_t number, std::uint32_t &left, std::uint32_t &right);
+    std::uint32_t allocate(double perimeter, std::size_t number);
+
+  public:
+    // Sorts the figures by perimeter and builds the tree from the sorted keys in linear time
+    void build(const FigureStore &store);
+    void clear();
+
+    void insert(double perimeter, std::size_t number);
+    bool erase(double perimeter, std::size_t number);
+
+    std::size_t size() const;
+    bool empty() const;
+
+    std::size_t countBelow(double perimeter) const;
+    std::size_t countAtMost(double perimeter) const;
+    std::size_t countInRange(double minPerimeter, double maxPerimeter) const;
+    Key kth(std::size_t k) const;
+
+    // Visits the figures with a perimeter in [minPerimeter, maxPerimeter] in perimeter order
+    template <typename Consumer> void forEachInRange(double minPerimeter, double maxPerimeter, Consumer &&consumer) const;
+};
+
+template <typename Consumer>
+void PerimeterIndex::forEachInRange(const double minPerimeter, const double maxPerimeter, Consumer &&consumer) const
+{
+    std::vector<std::uint32_t> path;
+    std::uint32_t node = root;
+
+    while (node != NIL || !path.empty())
+    {
+        // Descend left only while the left subtree can still hold perimeters >= minPerimeter
+        while (node != NIL)
+        {
+            if (nodes[node].perimeter < minPerimeter)
+            {
+                node = nodes[node].right;
+                continue;
+            }
+            path.push_back(node);
+            node = nodes[node].left;
+        }
+
+        if (path.empty())
+        {
+            break;
+        }
+
+        node = path.back();
+        path.pop_back();
+
+        if (nodes[node].perimeter > maxPerimeter)
+        {
+            break;
+        }
+
+        consumer(Key{nodes[node].perimeter, nodes[node].number});
+        node = nodes[node].right;
+    }
+}
+
+#endif // FIGURES_PERIMETERINDEX_HPP
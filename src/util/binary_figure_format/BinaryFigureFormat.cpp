@@ -0,0 +1,373 @@
+#include "BinaryFigureFormat.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../figure/plugin_figure/PluginFigure.hpp"
+#include "../../store/figure_store/FigureStore.hpp"
+#include "../figure_plugin/FigurePlugin.hpp"
+#include "../figure_registry/FigureRegistry.hpp"
+
+namespace
+{
+constexpr std::size_t WRITE_BUFFER_SIZE = 1 << 20;
+
+class LittleEndianWriter
+{
+  private:
+    std::ostream &output;
+    std::vector<char> buffer;
+
+  public:
+    explicit LittleEndianWriter(std::ostream &output) : output(output)
+    {
+        buffer.reserve(WRITE_BUFFER_SIZE);
+    }
+
+    template <typename T> void put(const T value)
+    {
+        if (buffer.size() + sizeof(T) > WRITE_BUFFER_SIZE)
+        {
+            flush();
+        }
+
+        for (unsigned i = 0; i < sizeof(T); i++)
+        {
+            buffer.push_back(static_cast<char>(value >> (8 * i)));
+        }
+    }
+
+    void putBytes(const std::span<const char> bytes)
+    {
+        if (buffer.size() + bytes.size() > WRITE_BUFFER_SIZE)
+        {
+            flush();
+        }
+
+        buffer.insert(buffer.end(), bytes.begin(), bytes.end());
+    }
+
+    void putDouble(const double value)
+    {
+        if (buffer.size() + sizeof(double) > WRITE_BUFFER_SIZE)
+        {
+            flush();
+        }
+
+        buffer.resize(buffer.size() + sizeof(double));
+        BinaryFigureFormat::writeDouble(buffer.data() + buffer.size() - sizeof(double), value);
+    }
+
+    void flush()
+    {
+        output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+        buffer.clear();
+    }
+};
+
+template <typename T> T readInteger(const char *bytes)
+{
+    T value = 0;
+    for (unsigned i = 0; i < sizeof(T); i++)
+    {
+        value |= static_cast<T>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+    }
+    return value;
+}
+
+[[noreturn]] void throwCorrupt()
+{
+    throw std::runtime_error("Binary figure file is truncated or corrupt");
+}
+} // namespace
+
+std::uint32_t BinaryFigureFormat::PluginTypes::indexOf(const PluginFigure &figure)
+{
+    const std::string_view name = figure.getRegistry().name(figure.getTypeId());
+
+    const auto [found, added] = indices.try_emplace(name, static_cast<std::uint32_t>(types.size()));
+    if (added)
+    {
+        types.push_back({name, static_cast<unsigned>(figure.getParams().size())});
+    }
+
+    return found->second;
+}
+
+std::span<const BinaryFigureFormat::PluginType> BinaryFigureFormat::PluginTypes::get() const
+{
+    return types;
+}
+
+void BinaryFigureFormat::write(std::ostream &output, const FigureStore &store)
+{
+    const std::span<const FigureStore::Entry> entries = store.getEntries();
+    const std::span<const PluginFigure> pluginFigures = store.getPluginFigures();
+
+    Header header{store.size(), {}, pluginFigures.empty() ? VERSION : PLUGIN_VERSION};
+    for (unsigned type = 0; type < FigureUtil::FIGURE_NUM; type++)
+    {
+        header.typeCounts[type] = store.getColumn(static_cast<FigureUtil::FigureType>(type), 0).size();
+    }
+    writeHeader(output, header);
+
+    LittleEndianWriter writer(output);
+
+    for (const FigureStore::Entry entry : entries)
+    {
+        if (entry.type != FigureStore::VACANT)
+        {
+            writer.put(entry.type);
+        }
+    }
+
+    // Store rows are not kept in figure order after a removal, so each column is written in figure order instead
+    for (unsigned type = 0; type < FigureUtil::FIGURE_NUM; type++)
+    {
+        const auto figureType = static_cast<FigureUtil::FigureType>(type);
+        for (unsigned param = 0; param < FigureRegistry::params(figureType); param++)
+        {
+            const std::span<const double> values = store.getColumn(figureType, param);
+            for (const FigureStore::Entry entry : entries)
+            {
+                if (entry.type == type)
+                {
+                    writer.putDouble(values[entry.row]);
+                }
+            }
+        }
+    }
+    writer.flush();
+
+    if (pluginFigures.empty())
+    {
+        return;
+    }
+
+    // The type table comes first, so the records are encoded once the types of every plugin figure are known
+    PluginTypes types;
+    std::vector<std::uint32_t> typeIndices(pluginFigures.size());
+    for (const FigureStore::Entry entry : entries)
+    {
+        if (entry.type == FigureStore::PLUGIN)
+        {
+            typeIndices[entry.row] = types.indexOf(pluginFigures[entry.row]);
+        }
+    }
+    writePluginTable(output, types.get());
+
+    std::vector<char> record;
+    for (const FigureStore::Entry entry : entries)
+    {
+        if (entry.type == FigureStore::PLUGIN)
+        {
+            record.clear();
+            appendPluginRecord(record, typeIndices[entry.row], pluginFigures[entry.row].getParams());
+            writer.putBytes(record);
+        }
+    }
+    writer.flush();
+}
+
+void BinaryFigureFormat::writeHeader(std::ostream &output, const Header &header)
+{
+    LittleEndianWriter writer(output);
+
+    for (const char c : MAGIC)
+    {
+        writer.put(c);
+    }
+    writer.put(header.version);
+    writer.put(std::uint16_t{0});
+    writer.put(header.figureCount);
+
+    for (const std::uint64_t count : header.typeCounts)
+    {
+        writer.put(count);
+    }
+
+    writer.flush();
+}
+
+void BinaryFigureFormat::writePluginTable(std::ostream &output, const std::span<const PluginType> types)
+{
+    LittleEndianWriter writer(output);
+
+    writer.put(static_cast<std::uint32_t>(types.size()));
+    for (const PluginType &type : types)
+    {
+        writer.put(static_cast<std::uint8_t>(type.name.size()));
+        writer.putBytes(type.name);
+        writer.put(static_cast<std::uint8_t>(type.params));
+    }
+
+    writer.flush();
+}
+
+void BinaryFigureFormat::appendPluginRecord(std::vector<char> &buffer, const std::uint32_t type,
+                                            const std::span<const double> params)
+{
+    for (unsigned i = 0; i < sizeof(type); i++)
+    {
+        buffer.push_back(static_cast<char>(type >> (8 * i)));
+    }
+
+    for (const double param : params)
+    {
+        buffer.resize(buffer.size() + sizeof(double));
+        writeDouble(buffer.data() + buffer.size() - sizeof(double), param);
+    }
+}
+
+BinaryFigureFormat::Header BinaryFigureFormat::readHeader(const std::string_view data)
+{
+    if (data.size() < HEADER_SIZE || !std::equal(MAGIC.begin(), MAGIC.end(), data.begin()))
+    {
+        throw std::runtime_error("Not a binary figure file");
+    }
+
+    const auto version = readInteger<std::uint16_t>(data.data() + 4);
+    if (version != VERSION && version != PLUGIN_VERSION)
+    {
+        throw std::runtime_error("Unsupported binary figure file version: " + std::to_string(version));
+    }
+
+    Header header{};
+    header.version = version;
+    header.figureCount = readInteger<std::uint64_t>(data.data() + 8);
+    for (unsigned type = 0; type < FigureUtil::FIGURE_NUM; type++)
+    {
+        header.typeCounts[type] = readInteger<std::uint64_t>(data.data() + 16 + 8 * type);
+    }
+
+    // Only version 2 files hold plugin figures, which the per-type counts leave out
+    const std::size_t available = data.size() - HEADER_SIZE;
+    const std::uint64_t builtins = header.figureCount - pluginCount(header);
+    if (header.figureCount > available ||
+        std::ranges::any_of(header.typeCounts, [&](const std::uint64_t count) { return count > header.figureCount; }) ||
+        builtins > header.figureCount || (version == VERSION && builtins != header.figureCount))
+    {
+        throwCorrupt();
+    }
+
+    std::uint64_t values = 0;
+    for (unsigned type = 0; type < FigureUtil::FIGURE_NUM; type++)
+    {
+        values += header.typeCounts[type] * FigureRegistry::params(static_cast<FigureUtil::FigureType>(type));
+    }
+
+    const std::uint64_t columnsEnd = header.figureCount + values * sizeof(double);
+    if (version == VERSION ? available != columnsEnd : available < columnsEnd)
+    {
+        throwCorrupt();
+    }
+
+    std::array<std::uint64_t, FigureUtil::FIGURE_NUM + 1> seen{};
+    for (const char type : data.substr(HEADER_SIZE, header.figureCount))
+    {
+        const auto index = static_cast<unsigned char>(type);
+        if (index > FigureStore::PLUGIN || (index == FigureStore::PLUGIN && version == VERSION))
+        {
+            throwCorrupt();
+        }
+        seen[index]++;
+    }
+
+    if (!std::equal(header.typeCounts.begin(), header.typeCounts.end(), seen.begin()))
+    {
+        throwCorrupt();
+    }
+
+    if (version == PLUGIN_VERSION)
+    {
+        const PluginTable table = readPluginTable(data, header);
+
+        std::size_t offset = table.recordOffset;
+        for (std::uint64_t figure = 0; figure < pluginCount(header); figure++)
+        {
+            if (data.size() - offset < sizeof(std::uint32_t))
+            {
+                throwCorrupt();
+            }
+
+            const std::uint32_t type = readUint32(data.data() + offset);
+            if (type >= table.types.size() ||
+                data.size() - offset < sizeof(std::uint32_t) + table.types[type].params * sizeof(double))
+            {
+                throwCorrupt();
+            }
+            offset += sizeof(std::uint32_t) + table.types[type].params * sizeof(double);
+        }
+
+        if (offset != data.size())
+        {
+            throwCorrupt();
+        }
+    }
+
+    return header;
+}
+
+std::uint64_t BinaryFigureFormat::pluginCount(const Header &header)
+{
+    return header.figureCount - std::accumulate(header.typeCounts.begin(), header.typeCounts.end(), std::uint64_t{0});
+}
+
+std::size_t BinaryFigureFormat::columnOffset(const Header &header, const FigureUtil::FigureType type,
+                                             const unsigned param)
+{
+    std::size_t offset = HEADER_SIZE + header.figureCount;
+    for (unsigned previous = 0; previous < type; previous++)
+    {
+        offset += header.typeCounts[previous] *
+                  FigureRegistry::params(static_cast<FigureUtil::FigureType>(previous)) * sizeof(double);
+    }
+
+    return offset + param * header.typeCounts[type] * sizeof(double);
+}
+
+std::size_t BinaryFigureFormat::pluginSectionOffset(const Header &header)
+{
+    const auto last = static_cast<FigureUtil::FigureType>(FigureUtil::FIGURE_NUM - 1);
+
+    return columnOffset(header, last, FigureRegistry::params(last));
+}
+
+BinaryFigureFormat::PluginTable BinaryFigureFormat::readPluginTable(const std::string_view data,
+                                                                    const Header &header)
+{
+    std::size_t offset = pluginSectionOffset(header);
+    if (data.size() - offset < sizeof(std::uint32_t))
+    {
+        throwCorrupt();
+    }
+
+    const std::uint32_t typeCount = readUint32(data.data() + offset);
+    offset += sizeof(std::uint32_t);
+
+    PluginTable table{};
+    for (std::uint32_t i = 0; i < typeCount; i++)
+    {
+        if (data.size() - offset < 1 || data.size() - offset < 2 + static_cast<unsigned char>(data[offset]))
+        {
+            throwCorrupt();
+        }
+
+        const std::size_t nameSize = static_cast<unsigned char>(data[offset]);
+        const unsigned params = static_cast<unsigned char>(data[offset + 1 + nameSize]);
+        if (params > FIGURES_PLUGIN_MAX_PARAMS)
+        {
+            throwCorrupt();
+        }
+
+        table.types.push_back({data.substr(offset + 1, nameSize), params});
+        offset += 2 + nameSize;
+    }
+    table.recordOffset = offset;
+
+    return table;
+}
@@ -0,0 +1,124 @@
+#ifndef FIGURES_BINARYFIGUREFORMAT_HPP
+#define FIGURES_BINARYFIGUREFORMAT_HPP
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../figure_util/FigureUtil.hpp"
+
+class FigureStore;
+class PluginFigure;
+
+// Version 1 layout, all integers and doubles little-endian:
+//   "FIGB" | u16 version | u16 reserved | u64 figure count | u64 count per figure type
+//   u8 figure type per figure, in figure order
+//   the parameter columns of each figure type (triangle a, b, c, circle radius, rectangle width, height)
+// Version 2 also holds plugin figures, which have type FigureStore::PLUGIN in the type table and are not counted
+// per type in the header. A plugin section follows the columns:
+//   u32 plugin type count, then per plugin type: u8 name length | name | u8 parameter count
+//   per plugin figure, in figure order: u32 plugin type index | its parameters as doubles
+// Stores without plugin figures are written as version 1, so older readers still load them
+class BinaryFigureFormat
+{
+  public:
+    static constexpr std::array<char, 4> MAGIC = {'F', 'I', 'G', 'B'};
+    static constexpr std::uint16_t VERSION = 1;
+    static constexpr std::uint16_t PLUGIN_VERSION = 2;
+    static constexpr std::size_t HEADER_SIZE = 16 + 8 * FigureUtil::FIGURE_NUM;
+
+    struct Header
+    {
+        std::uint64_t figureCount;
+        std::array<std::uint64_t, FigureUtil::FIGURE_NUM> typeCounts;
+        std::uint16_t version = VERSION;
+    };
+
+    struct PluginType
+    {
+        std::string_view name;
+        unsigned params;
+    };
+
+    struct PluginTable
+    {
+        std::vector<PluginType> types;
+        // The offset of the first plugin figure record
+        std::size_t recordOffset;
+    };
+
+    // Numbers the plugin types of the figures written, in the order they first appear
+    class PluginTypes
+    {
+      private:
+        std::vector<PluginType> types;
+        std::unordered_map<std::string_view, std::uint32_t> indices;
+
+      public:
+        std::uint32_t indexOf(const PluginFigure &figure);
+        std::span<const PluginType> get() const;
+    };
+
+    static void write(std::ostream &output, const FigureStore &store);
+
+    static void writeHeader(std::ostream &output, const Header &header);
+
+    static void writePluginTable(std::ostream &output, std::span<const PluginType> types);
+
+    static void appendPluginRecord(std::vector<char> &buffer, std::uint32_t type, std::span<const double> params);
+
+    static Header readHeader(std::string_view data);
+
+    static std::uint64_t pluginCount(const Header &header);
+
+    static std::size_t columnOffset(const Header &header, FigureUtil::FigureType type, unsigned param);
+
+    static std::size_t pluginSectionOffset(const Header &header);
+
+    static PluginTable readPluginTable(std::string_view data, const Header &header);
+
+    static std::uint32_t readUint32(const char *bytes);
+
+    static double readDouble(const char *bytes);
+
+    static void writeDouble(char *bytes, double value);
+};
+
+inline std::uint32_t BinaryFigureFormat::readUint32(const char *bytes)
+{
+    std::uint32_t value = 0;
+    for (unsigned i = 0; i < sizeof(value); i++)
+    {
+        value |= static_cast<std::uint32_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+    }
+
+    return value;
+}
+
+inline double BinaryFigureFormat::readDouble(const char *bytes)
+{
+    std::uint64_t bits = 0;
+    for (unsigned i = 0; i < sizeof(bits); i++)
+    {
+        bits |= static_cast<std::uint64_t>(static_cast<unsigned char>(bytes[i])) << (8 * i);
+    }
+
+    return std::bit_cast<double>(bits);
+}
+
+inline void BinaryFigureFormat::writeDouble(char *bytes, const double value)
+{
+    const auto bits = std::bit_cast<std::uint64_t>(value);
+    for (unsigned i = 0; i < sizeof(bits); i++)
+    {
+        bytes[i] = static_cast<char>(bits >> (8 * i));
+    }
+}
+
+#endif // FIGURES_BINARYFIGUREFORMAT_HPP
@@ -0,0 +1,72 @@
+#include "FigureHash.hpp"
+
+#include <array>
+#include <bit>
+
+#include "../../figure/circle/Circle.hpp"
+#include "../../figure/plugin_figure/PluginFigure.hpp"
+#include "../../figure/rectangle/Rectangle.hpp"
+#include "../../figure/triangle/Triangle.hpp"
+
+namespace
+{
+// The finaliser of MurmurHash3
+std::uint64_t mix(std::uint64_t x)
+{
+    x = (x ^ (x >> 33)) * 0xFF51AFD7ED558CCDULL;
+    x = (x ^ (x >> 33)) * 0xC4CEB9FE1A85EC53ULL;
+    return x ^ (x >> 33);
+}
+
+std::uint64_t mixParams(std::uint64_t hash, const std::span<const double> params)
+{
+    for (const double param : params)
+    {
+        // Adding +0.0 turns -0.0 into +0.0 and leaves every other value alone
+        hash = mix(hash ^ std::bit_cast<std::uint64_t>(param + 0.0));
+    }
+    return hash;
+}
+} // namespace
+
+std::uint64_t FigureHash::hash(const FigureUtil::FigureType type, const std::span<const double> params)
+{
+    return mixParams(mix(0x9E3779B97F4A7C15ULL * (type + 1)), params);
+}
+
+std::uint64_t FigureHash::hashPlugin(const std::string_view name, const std::span<const double> params)
+{
+    // FNV-1a of the name, offset past the seeds of the built-in types
+    std::uint64_t seed = 0xCBF29CE484222325ULL;
+    for (const char c : name)
+    {
+        seed = (seed ^ static_cast<unsigned char>(c)) * 0x100000001B3ULL;
+    }
+    return mixParams(mix(seed + 0x9E3779B97F4A7C15ULL * (FigureUtil::FIGURE_NUM + 1)), params);
+}
+
+std::uint64_t FigureHash::hash(const Figure &figure)
+{
+    if (const auto *plugin = dynamic_cast<const PluginFigure *>(&figure))
+    {
+        return hashPlugin(plugin->getRegistry().name(plugin->getTypeId()), plugin->getParams());
+    }
+
+    switch (figure.getType())
+    {
+    case FigureUtil::TRIANGLE:
+    {
+        const auto &triangle = static_cast<const Triangle &>(figure);
+        return hash(FigureUtil::TRIANGLE, std::array{triangle.getA(), triangle.getB(), triangle.getC()});
+    }
+    case FigureUtil::CIRCLE:
+        return hash(FigureUtil::CIRCLE, std::array{static_cast<const Circle &>(figure).getRadius()});
+    case FigureUtil::RECTANGLE:
+    {
+        const auto &rectangle = static_cast<const Rectangle &>(figure);
+        return hash(FigureUtil::RECTANGLE, std::array{rectangle.getWidth(), rectangle.getHeight()});
+    }
+    }
+
+    return 0;
+}
@@ -0,0 +1,22 @@
+#ifndef FIGURES_FIGUREHASH_HPP
+#define FIGURES_FIGUREHASH_HPP
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+#include "../../figure/Figure.hpp"
+#include "../figure_util/FigureUtil.hpp"
+
+// A hash of the figure type and parameters that is the same on every run and platform. Parameters are compared
+// with ==, so -0.0 and +0.0 hash alike; they are never NaN, since the figures reject non-finite parameters.
+class FigureHash
+{
+  public:
+    static std::uint64_t hash(FigureUtil::FigureType type, std::span<const double> params);
+    // Plugin figures hash by the name of their type, which stays the same across runs unlike the type id
+    static std::uint64_t hashPlugin(std::string_view name, std::span<const double> params);
+    static std::uint64_t hash(const Figure &figure);
+};
+
+#endif // FIGURES_FIGUREHASH_HPP
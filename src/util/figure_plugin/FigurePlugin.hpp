@@ -0,0 +1,40 @@
+#ifndef FIGURES_FIGUREPLUGIN_HPP
+#define FIGURES_FIGUREPLUGIN_HPP
+
+#include <cstddef>
+
+// The C interface a figure plugin exports. A plugin is a shared library with an extern "C" function named
+// FIGURES_PLUGIN_ENTRY that returns a FiguresPlugin describing the figure types it adds
+
+#define FIGURES_PLUGIN_ABI_VERSION 1
+#define FIGURES_PLUGIN_ENTRY "figuresPlugin"
+#define FIGURES_PLUGIN_MAX_PARAMS 8
+#define FIGURES_PLUGIN_FORMAT_SIZE 128
+
+extern "C"
+{
+    struct FiguresPluginType
+    {
+        // Lowercase, and distinct from the built-in figure names
+        const char *name;
+        unsigned params;
+        // Nonzero when params describe a valid figure, which is what constructing it checks
+        int (*validate)(const double *params);
+        double (*perimeter)(const double *params);
+        // Column-wise batch kernel: columns[p][i] is parameter p of figure i
+        void (*perimeters)(const double *const *columns, std::size_t count, double *out);
+        // Writes at most FIGURES_PLUGIN_FORMAT_SIZE characters and returns the end of the written text
+        char *(*format)(const double *params, char *buffer);
+    };
+
+    struct FiguresPlugin
+    {
+        unsigned abiVersion;
+        std::size_t typeCount;
+        const FiguresPluginType *types;
+    };
+
+    typedef const FiguresPlugin *(*FiguresPluginEntry)();
+}
+
+#endif // FIGURES_FIGUREPLUGIN_HPP
@@ -0,0 +1,13 @@
+#include "FigureReader.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+
+void FigureReader::throwInvalidType(const std::string_view name)
+{
+    std::string figure(name);
+    std::ranges::transform(figure, figure.begin(), [](const unsigned char c) { return std::tolower(c); });
+
+    throw std::invalid_argument("Invalid figure type: '" + figure + "'");
+}
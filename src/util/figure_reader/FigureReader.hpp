@@ -0,0 +1,238 @@
+#ifndef FIGURES_FIGUREREADER_HPP
+#define FIGURES_FIGUREREADER_HPP
+
+#include <array>
+#include <cstddef>
+#include <exception>
+#include <expected>
+#include <memory>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+
+#include "../../figure/Figure.hpp"
+#include "../../figure/plugin_figure/PluginFigure.hpp"
+#include "../figure_registry/FigureRegistry.hpp"
+#include "../figure_util/FigureUtil.hpp"
+#include "../ingest_report/IngestReport.hpp"
+#include "../parse_error/ParseError.hpp"
+#include "../string_to_figure/StringToFigure.hpp"
+
+class FigureReader
+{
+  private:
+    [[noreturn]] static void throwInvalidType(std::string_view name);
+
+    template <typename Tokenizer> static void skipRecord(Tokenizer &tokenizer);
+
+  public:
+    template <typename Tokenizer, typename Consumer> static bool readWith(Tokenizer &tokenizer, Consumer &&consumer);
+
+    template <typename Tokenizer> static std::unique_ptr<Figure> read(Tokenizer &tokenizer);
+
+    template <typename Tokenizer, typename Consumer>
+    static std::expected<bool, ParseError::Code> tryReadWith(Tokenizer &tokenizer, Consumer &&consumer);
+
+    template <typename Tokenizer, typename Consumer>
+    static std::size_t readLenient(Tokenizer &tokenizer, std::size_t n, IngestReport &report, Consumer &&consumer);
+};
+
+template <typename Tokenizer, typename Consumer> bool FigureReader::readWith(Tokenizer &tokenizer, Consumer &&consumer)
+{
+    const std::string_view name = tokenizer.next();
+
+    if (name.empty())
+    {
+        return false;
+    }
+
+    const std::optional<FigureUtil::FigureType> type = StringToFigure::parseFigureType(name);
+    PluginRegistry::TypeId plugin = 0;
+
+    if (!type.has_value())
+    {
+        const std::optional<PluginRegistry::TypeId> found = StringToFigure::parsePluginType(name);
+        if (!found.has_value())
+        {
+            throwInvalidType(name);
+        }
+        plugin = *found;
+    }
+
+    std::array<double, StringToFigure::MAX_RECORD_PARAMS> params{};
+    const unsigned paramN =
+        type.has_value() ? FigureUtil::getFigureParams(*type) : StringToFigure::getPlugins()->params(plugin);
+
+    // All parameters are read before any is reported as invalid, so a short record still fails as unreadable
+    std::exception_ptr parseError;
+    for (unsigned i = 0; i < paramN; i++)
+    {
+        const std::string_view value = tokenizer.next();
+        if (value.empty())
+        {
+            throw std::runtime_error("Cannot read from input stream!");
+        }
+
+        if (parseError == nullptr)
+        {
+            try
+            {
+                params[i] = StringToFigure::parseNumber(value);
+            } catch (const std::invalid_argument &)
+            {
+                parseError = std::current_exception();
+            }
+        }
+    }
+
+    if (parseError != nullptr)
+    {
+        std::rethrow_exception(parseError);
+    }
+
+    if (!type.has_value())
+    {
+        consumer(PluginFigure(*StringToFigure::getPlugins(), plugin, std::span<const double>(params).first(paramN)));
+        return true;
+    }
+
+    FigureRegistry::visit(*type, [&]<typename T>() { consumer(FigureRegistry::make<T>(params)); });
+
+    return true;
+}
+
+template <typename Tokenizer> std::unique_ptr<Figure> FigureReader::read(Tokenizer &tokenizer)
+{
+    std::unique_ptr<Figure> figure;
+
+    readWith(tokenizer, [&figure]<typename T>(const T &value) { figure = std::make_unique<T>(value); });
+
+    return figure;
+}
+
+template <typename Tokenizer, typename Consumer>
+std::expected<bool, ParseError::Code> FigureReader::tryReadWith(Tokenizer &tokenizer, Consumer &&consumer)
+{
+    const std::string_view name = tokenizer.next();
+
+    if (name.empty())
+    {
+        return false;
+    }
+
+    const std::optional<FigureUtil::FigureType> type = StringToFigure::parseFigureType(name);
+    PluginRegistry::TypeId plugin = 0;
+
+    if (!type.has_value())
+    {
+        const std::optional<PluginRegistry::TypeId> found = StringToFigure::parsePluginType(name);
+        if (!found.has_value())
+        {
+            return std::unexpected(ParseError::UNKNOWN_FIGURE);
+        }
+        plugin = *found;
+    }
+
+    std::array<double, StringToFigure::MAX_RECORD_PARAMS> params{};
+    const unsigned paramN =
+        type.has_value() ? FigureUtil::getFigureParams(*type) : StringToFigure::getPlugins()->params(plugin);
+
+    std::optional<ParseError::Code> parseError;
+    for (unsigned i = 0; i < paramN; i++)
+    {
+        const std::string_view value = tokenizer.next();
+        if (value.empty())
+        {
+            return std::unexpected(ParseError::MISSING_PARAMETER);
+        }
+
+        // A figure name where a parameter was expected starts the next record, so it is left for the next read
+        if (StringToFigure::isFigureName(value))
+        {
+            tokenizer.unread();
+            return std::unexpected(ParseError::MISSING_PARAMETER);
+        }
+
+        const std::expected<double, ParseError::Code> number = StringToFigure::tryParseNumber(value);
+        if (number.has_value())
+        {
+            params[i] = *number;
+        }
+        else if (!parseError.has_value())
+        {
+            parseError = number.error();
+        }
+    }
+
+    if (parseError.has_value())
+    {
+        return std::unexpected(*parseError);
+    }
+
+    if (!type.has_value())
+    {
+        const std::expected<PluginFigure, ParseError::Code> figure = PluginFigure::tryCreate(
+            *StringToFigure::getPlugins(), plugin, std::span<const double>(params).first(paramN));
+        if (!figure.has_value())
+        {
+            return std::unexpected(figure.error());
+        }
+        consumer(*figure);
+        return true;
+    }
+
+    return FigureRegistry::visit(*type, [&]<typename T>() -> std::expected<bool, ParseError::Code> {
+        const auto figure = FigureRegistry::tryMake<T>(params);
+        if (!figure.has_value())
+        {
+            return std::unexpected(figure.error());
+        }
+        consumer(*figure);
+        return true;
+    });
+}
+
+template <typename Tokenizer> void FigureReader::skipRecord(Tokenizer &tokenizer)
+{
+    for (std::string_view token = tokenizer.next(); !token.empty(); token = tokenizer.next())
+    {
+        if (StringToFigure::isFigureName(token))
+        {
+            tokenizer.unread();
+            return;
+        }
+    }
+}
+
+template <typename Tokenizer, typename Consumer>
+std::size_t FigureReader::readLenient(Tokenizer &tokenizer, const std::size_t n, IngestReport &report,
+                                      Consumer &&consumer)
+{
+    std::size_t accepted = 0;
+
+    while (accepted < n)
+    {
+        const std::expected<bool, ParseError::Code> result = tryReadWith(tokenizer, consumer);
+
+        if (!result.has_value())
+        {
+            report.reject(result.error());
+            skipRecord(tokenizer);
+            continue;
+        }
+
+        if (!*result)
+        {
+            break;
+        }
+
+        report.accept();
+        accepted++;
+    }
+
+    return accepted;
+}
+
+#endif // FIGURES_FIGUREREADER_HPP
@@ -0,0 +1,158 @@
+#ifndef FIGURES_FIGUREREGISTRY_HPP
+#define FIGURES_FIGUREREGISTRY_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "../../figure/circle/Circle.hpp"
+#include "../../figure/rectangle/Rectangle.hpp"
+#include "../../figure/triangle/Triangle.hpp"
+#include "../figure_util/FigureUtil.hpp"
+
+// Everything that depends on the set of figure types is derived from one type list. Each figure declares its TYPE,
+// lowercase NAME, capitalised DISPLAY_NAME and number of PARAMS; names are looked up through a perfect hash built at
+// compile time and dispatch on a FigureType goes through a table indexed by it
+template <typename... Figures> class BasicFigureRegistry
+{
+  private:
+    using FigureList = std::tuple<Figures...>;
+
+    static constexpr std::size_t SIZE = sizeof...(Figures);
+
+    static constexpr std::array<std::string_view, SIZE> NAMES{Figures::NAME...};
+    static constexpr std::array<std::string_view, SIZE> DISPLAY_NAMES{Figures::DISPLAY_NAME...};
+    static constexpr std::array<unsigned, SIZE> PARAMS{Figures::PARAMS...};
+
+    static constexpr unsigned HASH_BITS = std::bit_width(2 * SIZE - 1) + 1;
+    static constexpr std::size_t HASH_EMPTY = SIZE;
+
+    static constexpr char toLower(const char c)
+    {
+        return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+    }
+
+    // Hashes only the length and the first and last letters, the full name is compared after the lookup
+    static constexpr std::size_t hash(const std::string_view name, const std::uint64_t seed)
+    {
+        const std::uint64_t key = name.size() | static_cast<std::uint64_t>(toLower(name.front())) << 16 |
+                                  static_cast<std::uint64_t>(toLower(name.back())) << 24;
+        return static_cast<std::size_t>(key * seed >> (64 - HASH_BITS));
+    }
+
+    static constexpr std::uint64_t findSeed()
+    {
+        for (std::uint64_t attempt = 1;; attempt++)
+        {
+            const std::uint64_t seed = attempt * 0x9E3779B97F4A7C15 | 1;
+            std::array<bool, std::size_t{1} << HASH_BITS> used{};
+            const bool collides = std::ranges::any_of(NAMES, [&](const std::string_view name) {
+                return std::exchange(used[hash(name, seed)], true);
+            });
+
+            if (!collides)
+            {
+                return seed;
+            }
+        }
+    }
+
+    static constexpr std::uint64_t SEED = findSeed();
+
+    static constexpr std::array<std::size_t, std::size_t{1} << HASH_BITS> buildTable()
+    {
+        std::array<std::size_t, std::size_t{1} << HASH_BITS> table{};
+        table.fill(HASH_EMPTY);
+        for (std::size_t i = 0; i < SIZE; i++)
+        {
+            table[hash(NAMES[i], SEED)] = i;
+        }
+        return table;
+    }
+
+    static constexpr std::array<std::size_t, std::size_t{1} << HASH_BITS> TABLE = buildTable();
+
+    static constexpr bool equalsIgnoreCase(const std::string_view str, const std::string_view lowercase)
+    {
+        return std::ranges::equal(str, lowercase, {}, toLower);
+    }
+
+    template <std::size_t... I> static constexpr bool typesMatchOrder(std::index_sequence<I...>)
+    {
+        return ((std::tuple_element_t<I, FigureList>::TYPE == I) && ...);
+    }
+
+    static_assert(SIZE == FigureUtil::FIGURE_NUM, "Every FigureType needs a registered figure");
+    static_assert(typesMatchOrder(std::index_sequence_for<Figures...>{}), "Figures must be listed in FigureType order");
+    static_assert(std::ranges::max(PARAMS) == FigureUtil::MAX_FIGURE_PARAMS);
+
+  public:
+    // The figure type with the given name, ignoring case
+    static constexpr std::optional<FigureUtil::FigureType> find(const std::string_view name)
+    {
+        if (name.empty())
+        {
+            return std::nullopt;
+        }
+
+        const std::size_t index = TABLE[hash(name, SEED)];
+        if (index == HASH_EMPTY || !equalsIgnoreCase(name, NAMES[index]))
+        {
+            return std::nullopt;
+        }
+
+        return static_cast<FigureUtil::FigureType>(index);
+    }
+
+    static constexpr std::string_view name(const FigureUtil::FigureType type)
+    {
+        return NAMES[type];
+    }
+
+    static constexpr std::string_view displayName(const FigureUtil::FigureType type)
+    {
+        return DISPLAY_NAMES[type];
+    }
+
+    static constexpr unsigned params(const FigureUtil::FigureType type)
+    {
+        return PARAMS[type];
+    }
+
+    // Calls visitor.template operator()<T>() for the figure class T of type
+    template <typename Visitor> static decltype(auto) visit(const FigureUtil::FigureType type, Visitor &&visitor)
+    {
+        using Result = decltype(visitor.template operator()<std::tuple_element_t<0, FigureList>>());
+        static constexpr std::array<Result (*)(Visitor &), SIZE> dispatch{
+            [](Visitor &v) -> Result { return v.template operator()<Figures>(); }...};
+
+        return dispatch[type](visitor);
+    }
+
+    // Constructs T from params, which must hold T::PARAMS values
+    template <typename T> static T make(const std::span<const double> params)
+    {
+        return [&]<std::size_t... I>(std::index_sequence<I...>) {
+            return T(params[I]...);
+        }(std::make_index_sequence<T::PARAMS>{});
+    }
+
+    template <typename T> static auto tryMake(const std::span<const double> params)
+    {
+        return [&]<std::size_t... I>(std::index_sequence<I...>) {
+            return T::tryCreate(params[I]...);
+        }(std::make_index_sequence<T::PARAMS>{});
+    }
+};
+
+using FigureRegistry = BasicFigureRegistry<Triangle, Circle, Rectangle>;
+
+#endif // FIGURES_FIGUREREGISTRY_HPP
@@ -2,44 +2,35 @@
 
 #include <stdexcept>
 
+#include "../figure_registry/FigureRegistry.hpp"
+
 FigureUtil::FigureType FigureUtil::strToFigure(const std::string &str)
 {
-    if (str == "triangle")
-    {
-        return TRIANGLE;
-    }
-
-    if (str == "circle")
-    {
-        return CIRCLE;
-    }
+    const std::expected<FigureType, ParseError::Code> type = tryStrToFigure(str);
 
-    if (str == "rectangle")
+    if (!type.has_value())
     {
-        return RECTANGLE;
+        throw std::invalid_argument("Invalid figure type: '" + str + "'");
     }
 
-    throw std::invalid_argument("Invalid figure type: '" + str + "'");
+    return *type;
 }
 
-unsigned FigureUtil::getFigureParams(const FigureType type)
+std::expected<FigureUtil::FigureType, ParseError::Code> FigureUtil::tryStrToFigure(const std::string &str)
 {
-    unsigned paramN = 0;
+    const std::optional<FigureType> type = FigureRegistry::find(str);
 
-    switch (type)
+    if (!type.has_value() || FigureRegistry::name(*type) != str)
     {
-    case TRIANGLE:
-        paramN = 3;
-        break;
-    case CIRCLE:
-        paramN = 1;
-        break;
-    case RECTANGLE:
-        paramN = 2;
-        break;
+        return std::unexpected(ParseError::UNKNOWN_FIGURE);
     }
 
-    return paramN;
+    return *type;
+}
+
+unsigned FigureUtil::getFigureParams(const FigureType type)
+{
+    return FigureRegistry::params(type);
 }
 
 FigureUtil::FigureType FigureUtil::getRandomFigureType(std::mt19937_64 &rng)
@@ -1,15 +1,18 @@
 #ifndef FIGURES_FIGURE_UTIL_HPP
 #define FIGURES_FIGURE_UTIL_HPP
 
+#include <expected>
 #include <random>
 #include <string>
 
+#include "../parse_error/ParseError.hpp"
+
 class FigureUtil
 {
-  private:
+  public:
     static constexpr unsigned FIGURE_NUM = 3;
+    static constexpr unsigned MAX_FIGURE_PARAMS = 3;
 
-  public:
     enum FigureType
     {
         TRIANGLE = 0,
@@ -19,6 +22,8 @@ class FigureUtil
 
     static FigureType strToFigure(const std::string &str);
 
+    static std::expected<FigureType, ParseError::Code> tryStrToFigure(const std::string &str);
+
     static unsigned getFigureParams(FigureType type);
 
     static FigureType getRandomFigureType(std::mt19937_64 &rng);
@@ -0,0 +1,28 @@
+#include "IngestReport.hpp"
+
+#include <numeric>
+
+void IngestReport::accept()
+{
+    accepted++;
+}
+
+void IngestReport::reject(const ParseError::Code code)
+{
+    rejected[code]++;
+}
+
+std::size_t IngestReport::getAccepted() const
+{
+    return accepted;
+}
+
+std::size_t IngestReport::getRejected(const ParseError::Code code) const
+{
+    return rejected[code];
+}
+
+std::size_t IngestReport::getRejected() const
+{
+    return std::accumulate(rejected.begin(), rejected.end(), std::size_t{0});
+}
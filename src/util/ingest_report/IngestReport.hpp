@@ -0,0 +1,24 @@
+#ifndef FIGURES_INGESTREPORT_HPP
+#define FIGURES_INGESTREPORT_HPP
+
+#include <array>
+#include <cstddef>
+
+#include "../parse_error/ParseError.hpp"
+
+class IngestReport
+{
+  private:
+    std::size_t accepted = 0;
+    std::array<std::size_t, ParseError::CODE_NUM> rejected{};
+
+  public:
+    void accept();
+    void reject(ParseError::Code code);
+
+    std::size_t getAccepted() const;
+    std::size_t getRejected(ParseError::Code code) const;
+    std::size_t getRejected() const;
+};
+
+#endif // FIGURES_INGESTREPORT_HPP
@@ -0,0 +1,62 @@
+#include "MappedFile.hpp"
+
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+MappedFile::MappedFile(const std::string &filename)
+{
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        throw std::runtime_error("Cannot open file: '" + filename + "'");
+    }
+
+    struct stat status{};
+    if (::fstat(fd, &status) != 0 || !S_ISREG(status.st_mode))
+    {
+        ::close(fd);
+        throw std::runtime_error("Cannot map file: '" + filename + "'");
+    }
+
+    size = static_cast<std::size_t>(status.st_size);
+
+    if (size > 0)
+    {
+        data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if (data == MAP_FAILED)
+        {
+            data = nullptr;
+            ::close(fd);
+            throw std::runtime_error("Cannot map file: '" + filename + "'");
+        }
+
+        ::madvise(data, size, MADV_SEQUENTIAL);
+    }
+
+    ::close(fd);
+}
+
+MappedFile::~MappedFile()
+{
+    if (data != nullptr)
+    {
+        ::munmap(data, size);
+    }
+}
+
+std::string_view MappedFile::view() const
+{
+    return {static_cast<const char *>(data), size};
+}
+
+bool MappedFile::isRegularFile(const std::string &filename)
+{
+    struct stat status{};
+    return ::stat(filename.c_str(), &status) == 0 && S_ISREG(status.st_mode);
+}
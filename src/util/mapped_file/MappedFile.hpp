@@ -0,0 +1,27 @@
+#ifndef FIGURES_MAPPEDFILE_HPP
+#define FIGURES_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+class MappedFile
+{
+  private:
+    void *data = nullptr;
+    std::size_t size = 0;
+
+  public:
+    explicit MappedFile(const std::string &filename);
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    ~MappedFile();
+
+    std::string_view view() const;
+
+    static bool isRegularFile(const std::string &filename);
+};
+
+#endif // FIGURES_MAPPEDFILE_HPP
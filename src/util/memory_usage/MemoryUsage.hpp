@@ -0,0 +1,13 @@
+#ifndef FIGURES_MEMORYUSAGE_HPP
+#define FIGURES_MEMORYUSAGE_HPP
+
+#include <cstddef>
+
+class MemoryUsage
+{
+  public:
+    // Peak resident set size of the process so far, 0 when the platform does not report it
+    static std::size_t peakResidentBytes();
+};
+
+#endif // FIGURES_MEMORYUSAGE_HPP
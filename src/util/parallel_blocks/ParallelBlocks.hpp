@@ -0,0 +1,38 @@
+#ifndef FIGURES_PARALLEL_BLOCKS_HPP
+#define FIGURES_PARALLEL_BLOCKS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+class ParallelBlocks
+{
+  public:
+    // Splits [0, n) into 'threads' consecutive blocks and calls function(block, first, last) for each one on its own
+    // thread. With a single block the function runs on the calling thread.
+    template <typename Function> static void forEach(const unsigned threads, const std::size_t n, Function &&function)
+    {
+        if (threads == 1)
+        {
+            function(0u, std::size_t{0}, n);
+            return;
+        }
+
+        const std::size_t blockSize = (n + threads - 1) / threads;
+        std::vector<std::thread> workers;
+        workers.reserve(threads);
+        for (unsigned t = 0; t < threads; t++)
+        {
+            const std::size_t first = std::min(n, t * blockSize);
+            workers.emplace_back(function, t, first, std::min(n, first + blockSize));
+        }
+
+        for (std::thread &worker : workers)
+        {
+            worker.join();
+        }
+    }
+};
+
+#endif // FIGURES_PARALLEL_BLOCKS_HPP
@@ -0,0 +1,38 @@
+#include "ParseError.hpp"
+
+const char *ParseError::describe(const Code code)
+{
+    switch (code)
+    {
+    case UNKNOWN_FIGURE:
+        return "Invalid figure type";
+    case MISSING_PARAMETER:
+        return "Cannot read from input stream!";
+    case WRONG_PARAMETER_COUNT:
+        return "Wrong number of parameters";
+    case INVALID_NUMBER:
+        return "Not a valid number";
+    case NUMBER_OUT_OF_RANGE:
+        return "Number can't be stored in a double";
+    case INVALID_RADIUS:
+        return "Radius must be a finite positive value";
+    case INVALID_WIDTH:
+        return "'width' must be a finite positive value";
+    case INVALID_HEIGHT:
+        return "'height' must be a finite positive value";
+    case INVALID_SIDE_A:
+        return "'a' must be a finite positive value";
+    case INVALID_SIDE_B:
+        return "'b' must be a finite positive value";
+    case INVALID_SIDE_C:
+        return "'c' must be a finite positive value";
+    case INVALID_TRIANGLE:
+        return "No triangle with such sides exist!";
+    case INVALID_PERIMETER:
+        return "Perimeter must be a finite positive value";
+    case INVALID_PLUGIN_FIGURE:
+        return "Parameters rejected by the figure plugin";
+    }
+
+    return "Unknown error";
+}
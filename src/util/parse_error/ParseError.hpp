@@ -0,0 +1,32 @@
+#ifndef FIGURES_PARSEERROR_HPP
+#define FIGURES_PARSEERROR_HPP
+
+#include <cstdint>
+
+class ParseError
+{
+  public:
+    enum Code : std::uint8_t
+    {
+        UNKNOWN_FIGURE = 0,
+        MISSING_PARAMETER,
+        WRONG_PARAMETER_COUNT,
+        INVALID_NUMBER,
+        NUMBER_OUT_OF_RANGE,
+        INVALID_RADIUS,
+        INVALID_WIDTH,
+        INVALID_HEIGHT,
+        INVALID_SIDE_A,
+        INVALID_SIDE_B,
+        INVALID_SIDE_C,
+        INVALID_TRIANGLE,
+        INVALID_PERIMETER,
+        INVALID_PLUGIN_FIGURE
+    };
+
+    static constexpr unsigned CODE_NUM = INVALID_PLUGIN_FIGURE + 1;
+
+    static const char *describe(Code code);
+};
+
+#endif // FIGURES_PARSEERROR_HPP
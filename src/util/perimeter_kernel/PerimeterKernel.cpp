@@ -0,0 +1,244 @@
+#include "PerimeterKernel.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define FIGURES_X86_KERNELS
+#include <immintrin.h>
+#endif
+
+namespace
+{
+void trianglesScalar(const double *a, const double *b, const double *c, double *out, const std::size_t n)
+{
+    for (std::size_t i = 0; i < n; i++)
+    {
+        out[i] = a[i] + b[i] + c[i];
+    }
+}
+
+void circlesScalar(const double *radius, double *out, const std::size_t n)
+{
+    for (std::size_t i = 0; i < n; i++)
+    {
+        out[i] = 2 * M_PI * radius[i];
+    }
+}
+
+void rectanglesScalar(const double *width, const double *height, double *out, const std::size_t n)
+{
+    for (std::size_t i = 0; i < n; i++)
+    {
+        out[i] = 2 * width[i] + 2 * height[i];
+    }
+}
+
+#ifdef FIGURES_X86_KERNELS
+__attribute__((target("sse2"))) void trianglesSse2(const double *a, const double *b, const double *c, double *out,
+                                                   const std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+        const __m128d sum = _mm_add_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i));
+        _mm_storeu_pd(out + i, _mm_add_pd(sum, _mm_loadu_pd(c + i)));
+    }
+    trianglesScalar(a + i, b + i, c + i, out + i, n - i);
+}
+
+__attribute__((target("sse2"))) void circlesSse2(const double *radius, double *out, const std::size_t n)
+{
+    const __m128d factor = _mm_set1_pd(2 * M_PI);
+
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+        _mm_storeu_pd(out + i, _mm_mul_pd(factor, _mm_loadu_pd(radius + i)));
+    }
+    circlesScalar(radius + i, out + i, n - i);
+}
+
+__attribute__((target("sse2"))) void rectanglesSse2(const double *width, const double *height, double *out,
+                                                    const std::size_t n)
+{
+    const __m128d two = _mm_set1_pd(2);
+
+    std::size_t i = 0;
+    for (; i + 2 <= n; i += 2)
+    {
+        const __m128d doubleWidth = _mm_mul_pd(two, _mm_loadu_pd(width + i));
+        const __m128d doubleHeight = _mm_mul_pd(two, _mm_loadu_pd(height + i));
+        _mm_storeu_pd(out + i, _mm_add_pd(doubleWidth, doubleHeight));
+    }
+    rectanglesScalar(width + i, height + i, out + i, n - i);
+}
+
+__attribute__((target("avx2"))) void trianglesAvx2(const double *a, const double *b, const double *c, double *out,
+                                                   const std::size_t n)
+{
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m256d sum = _mm256_add_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i));
+        _mm256_storeu_pd(out + i, _mm256_add_pd(sum, _mm256_loadu_pd(c + i)));
+    }
+    trianglesScalar(a + i, b + i, c + i, out + i, n - i);
+}
+
+__attribute__((target("avx2"))) void circlesAvx2(const double *radius, double *out, const std::size_t n)
+{
+    const __m256d factor = _mm256_set1_pd(2 * M_PI);
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(factor, _mm256_loadu_pd(radius + i)));
+    }
+    circlesScalar(radius + i, out + i, n - i);
+}
+
+__attribute__((target("avx2"))) void rectanglesAvx2(const double *width, const double *height, double *out,
+                                                    const std::size_t n)
+{
+    const __m256d two = _mm256_set1_pd(2);
+
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4)
+    {
+        const __m256d doubleWidth = _mm256_mul_pd(two, _mm256_loadu_pd(width + i));
+        const __m256d doubleHeight = _mm256_mul_pd(two, _mm256_loadu_pd(height + i));
+        _mm256_storeu_pd(out + i, _mm256_add_pd(doubleWidth, doubleHeight));
+    }
+    rectanglesScalar(width + i, height + i, out + i, n - i);
+}
+#endif
+} // namespace
+
+void PerimeterKernel::checkSizes(const std::size_t expected, const std::size_t actual, const std::size_t outSize)
+{
+    if (expected != actual)
+    {
+        throw std::invalid_argument("Figure columns must have the same length");
+    }
+
+    if (outSize < expected)
+    {
+        throw std::invalid_argument("Output buffer is too small for the figure columns");
+    }
+}
+
+PerimeterKernel::Isa PerimeterKernel::detectIsa()
+{
+#ifdef FIGURES_X86_KERNELS
+    static const Isa isa = __builtin_cpu_supports("avx2") ? AVX2 : __builtin_cpu_supports("sse2") ? SSE2 : SCALAR;
+    return isa;
+#else
+    return SCALAR;
+#endif
+}
+
+bool PerimeterKernel::isSupported(const Isa isa)
+{
+    return isa <= detectIsa();
+}
+
+std::span<double> PerimeterKernel::triangles(const std::span<const double> a, const std::span<const double> b,
+                                             const std::span<const double> c, const std::span<double> out)
+{
+    return triangles(detectIsa(), a, b, c, out);
+}
+
+std::span<double> PerimeterKernel::triangles(const Isa isa, const std::span<const double> a,
+                                             const std::span<const double> b, const std::span<const double> c,
+                                             const std::span<double> out)
+{
+    checkSizes(a.size(), b.size(), out.size());
+    checkSizes(a.size(), c.size(), out.size());
+
+    if (!isSupported(isa))
+    {
+        throw std::invalid_argument("Instruction set is not supported by this CPU");
+    }
+
+    switch (isa)
+    {
+#ifdef FIGURES_X86_KERNELS
+    case AVX2:
+        trianglesAvx2(a.data(), b.data(), c.data(), out.data(), a.size());
+        break;
+    case SSE2:
+        trianglesSse2(a.data(), b.data(), c.data(), out.data(), a.size());
+        break;
+#endif
+    default:
+        trianglesScalar(a.data(), b.data(), c.data(), out.data(), a.size());
+    }
+
+    return out.first(a.size());
+}
+
+std::span<double> PerimeterKernel::circles(const std::span<const double> radius, const std::span<double> out)
+{
+    return circles(detectIsa(), radius, out);
+}
+
+std::span<double> PerimeterKernel::circles(const Isa isa, const std::span<const double> radius,
+                                           const std::span<double> out)
+{
+    checkSizes(radius.size(), radius.size(), out.size());
+
+    if (!isSupported(isa))
+    {
+        throw std::invalid_argument("Instruction set is not supported by this CPU");
+    }
+
+    switch (isa)
+    {
+#ifdef FIGURES_X86_KERNELS
+    case AVX2:
+        circlesAvx2(radius.data(), out.data(), radius.size());
+        break;
+    case SSE2:
+        circlesSse2(radius.data(), out.data(), radius.size());
+        break;
+#endif
+    default:
+        circlesScalar(radius.data(), out.data(), radius.size());
+    }
+
+    return out.first(radius.size());
+}
+
+std::span<double> PerimeterKernel::rectangles(const std::span<const double> width, const std::span<const double> height,
+                                              const std::span<double> out)
+{
+    return rectangles(detectIsa(), width, height, out);
+}
+
+std::span<double> PerimeterKernel::rectangles(const Isa isa, const std::span<const double> width,
+                                              const std::span<const double> height, const std::span<double> out)
+{
+    checkSizes(width.size(), height.size(), out.size());
+
+    if (!isSupported(isa))
+    {
+        throw std::invalid_argument("Instruction set is not supported by this CPU");
+    }
+
+    switch (isa)
+    {
+#ifdef FIGURES_X86_KERNELS
+    case AVX2:
+        rectanglesAvx2(width.data(), height.data(), out.data(), width.size());
+        break;
+    case SSE2:
+        rectanglesSse2(width.data(), height.data(), out.data(), width.size());
+        break;
+#endif
+    default:
+        rectanglesScalar(width.data(), height.data(), out.data(), width.size());
+    }
+
+    return out.first(width.size());
+}
@@ -0,0 +1,39 @@
+#ifndef FIGURES_PERIMETERKERNEL_HPP
+#define FIGURES_PERIMETERKERNEL_HPP
+
+#include <cstddef>
+#include <span>
+
+class PerimeterKernel
+{
+  public:
+    enum Isa
+    {
+        SCALAR = 0,
+        SSE2,
+        AVX2
+    };
+
+  private:
+    static void checkSizes(std::size_t expected, std::size_t actual, std::size_t outSize);
+
+  public:
+    static Isa detectIsa();
+
+    static bool isSupported(Isa isa);
+
+    static std::span<double> triangles(std::span<const double> a, std::span<const double> b,
+                                       std::span<const double> c, std::span<double> out);
+    static std::span<double> triangles(Isa isa, std::span<const double> a, std::span<const double> b,
+                                       std::span<const double> c, std::span<double> out);
+
+    static std::span<double> circles(std::span<const double> radius, std::span<double> out);
+    static std::span<double> circles(Isa isa, std::span<const double> radius, std::span<double> out);
+
+    static std::span<double> rectangles(std::span<const double> width, std::span<const double> height,
+                                        std::span<double> out);
+    static std::span<double> rectangles(Isa isa, std::span<const double> width, std::span<const double> height,
+                                        std::span<double> out);
+};
+
+#endif // FIGURES_PERIMETERKERNEL_HPP
@@ -0,0 +1,42 @@
+#include "Philox.hpp"
+
+namespace
+{
+constexpr std::uint32_t MULTIPLIER_0 = 0xD2511F53;
+constexpr std::uint32_t MULTIPLIER_1 = 0xCD9E8D57;
+constexpr std::uint32_t WEYL_0 = 0x9E3779B9;
+constexpr std::uint32_t WEYL_1 = 0xBB67AE85;
+constexpr unsigned ROUNDS = 10;
+} // namespace
+
+Philox::Counter Philox::generate(Counter counter, Key key)
+{
+    for (unsigned round = 0; round < ROUNDS; round++)
+    {
+        const std::uint64_t product0 = static_cast<std::uint64_t>(MULTIPLIER_0) * counter[0];
+        const std::uint64_t product1 = static_cast<std::uint64_t>(MULTIPLIER_1) * counter[2];
+
+        counter = {static_cast<std::uint32_t>(product1 >> 32) ^ counter[1] ^ key[0], static_cast<std::uint32_t>(product1),
+                   static_cast<std::uint32_t>(product0 >> 32) ^ counter[3] ^ key[1], static_cast<std::uint32_t>(product0)};
+
+        key[0] += WEYL_0;
+        key[1] += WEYL_1;
+    }
+
+    return counter;
+}
+
+std::array<std::uint64_t, 2> Philox::generate64(const std::uint64_t counter, const std::uint32_t block,
+                                                const std::uint64_t seed)
+{
+    const Counter output = generate(
+        {static_cast<std::uint32_t>(counter), static_cast<std::uint32_t>(counter >> 32), block, 0},
+        {static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)});
+
+    return {static_cast<std::uint64_t>(output[1]) << 32 | output[0], static_cast<std::uint64_t>(output[3]) << 32 | output[2]};
+}
+
+double Philox::toUnitDouble(const std::uint64_t bits)
+{
+    return static_cast<double>(bits >> 11) * 0x1p-53;
+}
@@ -0,0 +1,21 @@
+#ifndef FIGURES_PHILOX_HPP
+#define FIGURES_PHILOX_HPP
+
+#include <array>
+#include <cstdint>
+
+// Philox4x32-10 counter-based generator (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3")
+class Philox
+{
+  public:
+    using Counter = std::array<std::uint32_t, 4>;
+    using Key = std::array<std::uint32_t, 2>;
+
+    static Counter generate(Counter counter, Key key);
+
+    static std::array<std::uint64_t, 2> generate64(std::uint64_t counter, std::uint32_t block, std::uint64_t seed);
+
+    static double toUnitDouble(std::uint64_t bits);
+};
+
+#endif // FIGURES_PHILOX_HPP
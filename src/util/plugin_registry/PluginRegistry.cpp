@@ -0,0 +1,242 @@
+#include "PluginRegistry.hpp"
+
+#include <dlfcn.h>
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <stdexcept>
+
+#include "../figure_registry/FigureRegistry.hpp"
+
+namespace
+{
+char toLower(const char c)
+{
+    return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+bool isComplete(const FiguresPluginType &type)
+{
+    return type.name != nullptr && type.params > 0 && type.params <= FIGURES_PLUGIN_MAX_PARAMS &&
+           type.validate != nullptr && type.perimeter != nullptr && type.format != nullptr;
+}
+} // namespace
+
+void PluginRegistry::LibraryCloser::operator()(void *handle) const
+{
+    dlclose(handle);
+}
+
+std::size_t PluginRegistry::NameHash::operator()(const std::string_view name) const
+{
+    std::uint64_t hash = 0xCBF29CE484222325;
+    for (const char c : name)
+    {
+        hash = (hash ^ static_cast<unsigned char>(toLower(c))) * 0x100000001B3;
+    }
+    return static_cast<std::size_t>(hash);
+}
+
+bool PluginRegistry::NameEqual::operator()(const std::string_view left, const std::string_view right) const
+{
+    return std::ranges::equal(left, right, {}, toLower, toLower);
+}
+
+const FiguresPluginType &PluginRegistry::typeOf(const TypeId id) const
+{
+    if (id >= types.size())
+    {
+        throw std::out_of_range("No plugin figure type " + std::to_string(id));
+    }
+
+    return types[id];
+}
+
+const FiguresPluginType &PluginRegistry::checkedType(const TypeId id, const std::span<const double> params) const
+{
+    checkParamCount(id, params.size());
+
+    return types[id];
+}
+
+void PluginRegistry::registerTypes(const FiguresPlugin &plugin, const std::string &path)
+{
+    if (plugin.abiVersion != FIGURES_PLUGIN_ABI_VERSION)
+    {
+        throw std::runtime_error("Plugin '" + path + "' was built for figure plugin ABI " +
+                                 std::to_string(plugin.abiVersion));
+    }
+
+    const std::span<const FiguresPluginType> added(plugin.types, plugin.typeCount);
+
+    // Every type is checked before any is registered, so a rejected plugin leaves the registry unchanged
+    for (std::size_t i = 0; i < added.size(); i++)
+    {
+        if (!isComplete(added[i]))
+        {
+            throw std::invalid_argument("Plugin '" + path + "' has an incomplete figure type");
+        }
+
+        const std::string_view name = added[i].name;
+        const bool repeated = std::ranges::any_of(added.first(i), [&](const FiguresPluginType &other) {
+            return NameEqual()(name, other.name);
+        });
+        if (FigureRegistry::find(name).has_value() || ids.contains(name) || repeated)
+        {
+            throw std::invalid_argument("Figure type already registered: '" + std::string(name) + "'");
+        }
+    }
+
+    for (const FiguresPluginType &type : added)
+    {
+        std::string name(type.name);
+        std::ranges::transform(name, name.begin(), toLower);
+        ids.emplace(std::move(name), static_cast<TypeId>(types.size()));
+        types.push_back(type);
+    }
+}
+
+void PluginRegistry::load(const std::string &path)
+{
+    std::unique_ptr<void, LibraryCloser> library(dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL));
+    if (library == nullptr)
+    {
+        throw std::runtime_error("Cannot load plugin '" + path + "': " + dlerror());
+    }
+
+    const auto entry = reinterpret_cast<FiguresPluginEntry>(dlsym(library.get(), FIGURES_PLUGIN_ENTRY));
+    if (entry == nullptr)
+    {
+        throw std::runtime_error("Plugin '" + path + "' has no " FIGURES_PLUGIN_ENTRY " entry point");
+    }
+
+    const FiguresPlugin *plugin = entry();
+    if (plugin == nullptr)
+    {
+        throw std::runtime_error("Plugin '" + path + "' returned no figure types");
+    }
+
+    registerTypes(*plugin, path);
+    libraries.push_back(std::move(library));
+}
+
+std::size_t PluginRegistry::loadDirectory(const std::string &directory)
+{
+    if (!std::filesystem::is_directory(directory))
+    {
+        throw std::runtime_error("Cannot open plugin directory: '" + directory + "'");
+    }
+
+    std::vector<std::filesystem::path> paths;
+    for (const std::filesystem::directory_entry &entry : std::filesystem::directory_iterator(directory))
+    {
+        if (entry.is_regular_file() && entry.path().extension() == LIBRARY_EXTENSION)
+        {
+            paths.push_back(entry.path());
+        }
+    }
+    std::ranges::sort(paths);
+
+    const std::size_t before = types.size();
+    for (const std::filesystem::path &path : paths)
+    {
+        load(path.string());
+    }
+
+    return types.size() - before;
+}
+
+std::optional<PluginRegistry::TypeId> PluginRegistry::find(const std::string_view name) const
+{
+    const auto found = ids.find(name);
+    if (found == ids.end())
+    {
+        return std::nullopt;
+    }
+
+    return found->second;
+}
+
+std::size_t PluginRegistry::size() const
+{
+    return types.size();
+}
+
+std::string_view PluginRegistry::name(const TypeId id) const
+{
+    return typeOf(id).name;
+}
+
+unsigned PluginRegistry::params(const TypeId id) const
+{
+    return typeOf(id).params;
+}
+
+void PluginRegistry::checkParamCount(const TypeId id, const std::size_t paramN) const
+{
+    const FiguresPluginType &type = typeOf(id);
+
+    if (paramN != type.params)
+    {
+        throw std::invalid_argument("Figure type '" + std::string(type.name) + "' requires " +
+                                    std::to_string(type.params) + " parameters");
+    }
+}
+
+bool PluginRegistry::isValid(const TypeId id, const std::span<const double> params) const
+{
+    const FiguresPluginType &type = typeOf(id);
+
+    return params.size() == type.params && type.validate(params.data()) != 0;
+}
+
+double PluginRegistry::perimeter(const TypeId id, const std::span<const double> params) const
+{
+    return checkedType(id, params).perimeter(params.data());
+}
+
+void PluginRegistry::perimeters(const TypeId id, const std::span<const std::span<const double>> columns,
+                                const std::span<double> out) const
+{
+    checkParamCount(id, columns.size());
+    const FiguresPluginType &type = types[id];
+
+    std::array<const double *, FIGURES_PLUGIN_MAX_PARAMS> pointers{};
+    for (std::size_t p = 0; p < columns.size(); p++)
+    {
+        if (columns[p].size() < out.size())
+        {
+            throw std::invalid_argument("Parameter column is shorter than the output");
+        }
+        pointers[p] = columns[p].data();
+    }
+
+    if (type.perimeters != nullptr)
+    {
+        type.perimeters(pointers.data(), out.size(), out.data());
+        return;
+    }
+
+    std::array<double, FIGURES_PLUGIN_MAX_PARAMS> params{};
+    for (std::size_t i = 0; i < out.size(); i++)
+    {
+        for (std::size_t p = 0; p < columns.size(); p++)
+        {
+            params[p] = pointers[p][i];
+        }
+        out[i] = type.perimeter(params.data());
+    }
+}
+
+char *PluginRegistry::formatTo(const TypeId id, const std::span<const double> params, char *buffer) const
+{
+    return checkedType(id, params).format(params.data(), buffer);
+}
+
+void PluginRegistry::formatTo(const TypeId id, const std::span<const double> params, std::string &out) const
+{
+    const std::size_t size = out.size();
+    out.resize(size + FIGURES_PLUGIN_FORMAT_SIZE);
+    out.resize(formatTo(id, params, out.data() + size) - out.data());
+}
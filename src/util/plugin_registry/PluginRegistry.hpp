@@ -0,0 +1,75 @@
+#ifndef FIGURES_PLUGINREGISTRY_HPP
+#define FIGURES_PLUGINREGISTRY_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../figure_plugin/FigurePlugin.hpp"
+
+// Figure types added at runtime by plugins loaded with dlopen. Built-in names are resolved by FigureRegistry
+// first, so only names it does not know reach the hash map here
+class PluginRegistry
+{
+  public:
+    using TypeId = std::uint32_t;
+
+  private:
+    struct LibraryCloser
+    {
+        void operator()(void *handle) const;
+    };
+
+    // Names are stored in lowercase and looked up ignoring case, without copying the name being looked up
+    struct NameHash
+    {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view name) const;
+    };
+
+    struct NameEqual
+    {
+        using is_transparent = void;
+        bool operator()(std::string_view left, std::string_view right) const;
+    };
+
+    std::vector<std::unique_ptr<void, LibraryCloser>> libraries;
+    std::vector<FiguresPluginType> types;
+    std::unordered_map<std::string, TypeId, NameHash, NameEqual> ids;
+
+    const FiguresPluginType &typeOf(TypeId id) const;
+    const FiguresPluginType &checkedType(TypeId id, std::span<const double> params) const;
+    void registerTypes(const FiguresPlugin &plugin, const std::string &path);
+
+  public:
+    static constexpr std::string_view LIBRARY_EXTENSION = ".so";
+
+    // Loads one plugin library and registers its figure types
+    void load(const std::string &path);
+    // Loads every plugin library in directory in name order, returns the number of types registered
+    std::size_t loadDirectory(const std::string &directory);
+
+    // The plugin type with the given name, ignoring case
+    std::optional<TypeId> find(std::string_view name) const;
+    std::size_t size() const;
+
+    std::string_view name(TypeId id) const;
+    unsigned params(TypeId id) const;
+    // Throws std::invalid_argument unless a figure of the type takes paramN parameters
+    void checkParamCount(TypeId id, std::size_t paramN) const;
+    bool isValid(TypeId id, std::span<const double> params) const;
+    double perimeter(TypeId id, std::span<const double> params) const;
+    // columns[p][i] is parameter p of figure i, every column holds out.size() values
+    void perimeters(TypeId id, std::span<const std::span<const double>> columns, std::span<double> out) const;
+    // Writes at most FIGURES_PLUGIN_FORMAT_SIZE characters and returns the end of the written text
+    char *formatTo(TypeId id, std::span<const double> params, char *buffer) const;
+    void formatTo(TypeId id, std::span<const double> params, std::string &out) const;
+};
+
+#endif // FIGURES_PLUGINREGISTRY_HPP
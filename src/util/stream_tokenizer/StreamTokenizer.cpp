@@ -0,0 +1,141 @@
+#include "StreamTokenizer.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+bool isSpace(const char c)
+{
+    return std::isspace(static_cast<unsigned char>(c));
+}
+} // namespace
+
+StreamTokenizer::StreamTokenizer(std::istream &input, const bool readAhead, const std::size_t bufferSize)
+    : input(input), readAhead(readAhead), bufferSize(bufferSize)
+{
+    if (bufferSize == 0)
+    {
+        throw std::invalid_argument("Tokenizer buffer size must be positive");
+    }
+}
+
+void StreamTokenizer::refill()
+{
+    if (buffer.empty())
+    {
+        buffer.resize(bufferSize);
+    }
+
+    if (begin > 0)
+    {
+        std::copy(buffer.begin() + static_cast<std::ptrdiff_t>(begin), buffer.begin() + static_cast<std::ptrdiff_t>(end),
+                  buffer.begin());
+        end -= begin;
+        begin = 0;
+    }
+
+    if (end == buffer.size())
+    {
+        buffer.resize(buffer.size() * 2);
+    }
+
+    const std::streamsize count =
+        input.rdbuf()->sgetn(buffer.data() + end, static_cast<std::streamsize>(buffer.size() - end));
+
+    if (count <= 0)
+    {
+        exhausted = true;
+        return;
+    }
+
+    end += static_cast<std::size_t>(count);
+    bytesRead += static_cast<std::size_t>(count);
+}
+
+// Reads straight from the stream buffer and stops at the delimiter like operator>>, so nothing after the token is
+// consumed. Used for std::cin, where the application keeps reading menu input after the figures.
+std::string_view StreamTokenizer::nextUnbuffered()
+{
+    std::streambuf &streambuf = *input.rdbuf();
+    constexpr std::streambuf::int_type eof = std::streambuf::traits_type::eof();
+
+    std::streambuf::int_type c = streambuf.sgetc();
+    while (c != eof && isSpace(static_cast<char>(c)))
+    {
+        bytesRead++;
+        c = streambuf.snextc();
+    }
+
+    end = 0;
+    while (c != eof && !isSpace(static_cast<char>(c)))
+    {
+        if (end == buffer.size())
+        {
+            buffer.resize(std::max<std::size_t>(64, buffer.size() * 2));
+        }
+        buffer[end++] = static_cast<char>(c);
+        bytesRead++;
+        c = streambuf.snextc();
+    }
+
+    return {buffer.data(), end};
+}
+
+std::string_view StreamTokenizer::nextBuffered()
+{
+    while (true)
+    {
+        while (begin < end && isSpace(buffer[begin]))
+        {
+            begin++;
+        }
+
+        if (begin < end)
+        {
+            std::size_t tokenEnd = begin;
+            while (tokenEnd < end && !isSpace(buffer[tokenEnd]))
+            {
+                tokenEnd++;
+            }
+
+            if (tokenEnd < end || exhausted)
+            {
+                const std::string_view token(buffer.data() + begin, tokenEnd - begin);
+                begin = tokenEnd;
+                return token;
+            }
+        }
+        else if (exhausted)
+        {
+            return {};
+        }
+
+        refill();
+    }
+}
+
+std::string_view StreamTokenizer::next()
+{
+    if (repeatLast)
+    {
+        repeatLast = false;
+        return lastToken;
+    }
+
+    lastToken = readAhead ? nextBuffered() : nextUnbuffered();
+    return lastToken;
+}
+
+// The buffer is only touched by next(), so the view handed out last is still valid until the following call
+void StreamTokenizer::unread()
+{
+    repeatLast = true;
+}
+
+std::size_t StreamTokenizer::getBytesRead() const
+{
+    return bytesRead;
+}
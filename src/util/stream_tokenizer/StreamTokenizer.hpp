@@ -0,0 +1,41 @@
+#ifndef FIGURES_STREAMTOKENIZER_HPP
+#define FIGURES_STREAMTOKENIZER_HPP
+
+#include <cstddef>
+#include <istream>
+#include <string_view>
+#include <vector>
+
+class StreamTokenizer
+{
+  public:
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 1 << 20;
+
+  private:
+    std::istream &input;
+    const bool readAhead;
+    const std::size_t bufferSize;
+
+    std::vector<char> buffer;
+    std::size_t begin = 0;
+    std::size_t end = 0;
+    bool exhausted = false;
+    std::size_t bytesRead = 0;
+    std::string_view lastToken;
+    bool repeatLast = false;
+
+    void refill();
+    std::string_view nextBuffered();
+    std::string_view nextUnbuffered();
+
+  public:
+    StreamTokenizer(std::istream &input, bool readAhead, std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+
+    std::string_view next();
+
+    void unread();
+
+    std::size_t getBytesRead() const;
+};
+
+#endif // FIGURES_STREAMTOKENIZER_HPP
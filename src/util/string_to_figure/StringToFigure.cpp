@@ -1,68 +1,315 @@
 #include "StringToFigure.hpp"
 
-#include <algorithm>
-#include <memory>
-#include <sstream>
-#include <vector>
+#include <array>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+#include <string>
 
 #include "../../figure/circle/Circle.hpp"
 #include "../../figure/rectangle/Rectangle.hpp"
 #include "../../figure/triangle/Triangle.hpp"
+#include "../../store/figure_arena/FigureArena.hpp"
+#include "../figure_registry/FigureRegistry.hpp"
 
-#include <iostream>
+namespace
+{
+// Parameter counts as they read in error messages, indexed by the count
+constexpr std::array<std::string_view, FigureUtil::MAX_FIGURE_PARAMS + 1> COUNT_WORDS = {"no", "one", "two", "three"};
 
-std::unique_ptr<Figure> StringToFigure::createFigure(const std::string &representation)
+template <typename T>
+std::expected<std::unique_ptr<Figure>, ParseError::Code> toHandle(const std::expected<T, ParseError::Code> &figure)
 {
-    std::stringstream sstream(representation);
+    if (!figure.has_value())
+    {
+        return std::unexpected(figure.error());
+    }
 
-    std::string figureName;
-    std::vector<double> params;
+    return std::make_unique<T>(*figure);
+}
+} // namespace
 
-    sstream >> figureName;
-    std::ranges::transform(figureName, figureName.begin(), [](const unsigned char c) { return std::tolower(c); });
+std::string_view StringToFigure::nextToken(std::string_view &input)
+{
+    std::size_t begin = 0;
+    while (begin < input.size() && std::isspace(static_cast<unsigned char>(input[begin])))
+    {
+        begin++;
+    }
 
-    std::string temp;
-    while (sstream >> temp)
+    std::size_t end = begin;
+    while (end < input.size() && !std::isspace(static_cast<unsigned char>(input[end])))
     {
-        try
-        {
-            double value = std::stod(temp);
-            params.push_back(value);
-        } catch (const std::invalid_argument &e)
+        end++;
+    }
+
+    const std::string_view token = input.substr(begin, end - begin);
+    input.remove_prefix(end);
+    return token;
+}
+
+const PluginRegistry *StringToFigure::plugins = nullptr;
+
+std::optional<FigureUtil::FigureType> StringToFigure::parseFigureType(const std::string_view name)
+{
+    return FigureRegistry::find(name);
+}
+
+void StringToFigure::setPlugins(const PluginRegistry *plugins)
+{
+    StringToFigure::plugins = plugins;
+}
+
+const PluginRegistry *StringToFigure::getPlugins()
+{
+    return plugins;
+}
+
+std::optional<PluginRegistry::TypeId> StringToFigure::parsePluginType(const std::string_view name)
+{
+    if (plugins == nullptr || FigureRegistry::find(name).has_value())
+    {
+        return std::nullopt;
+    }
+
+    return plugins->find(name);
+}
+
+bool StringToFigure::isFigureName(const std::string_view name)
+{
+    return FigureRegistry::find(name).has_value() || (plugins != nullptr && plugins->find(name).has_value());
+}
+
+void StringToFigure::throwInvalidNumber(const ParseError::Code code, const std::string_view token)
+{
+    if (code == ParseError::NUMBER_OUT_OF_RANGE)
+    {
+        throw std::invalid_argument("'" + std::string(token) + "' can't be stored in a double");
+    }
+
+    throw std::invalid_argument("'" + std::string(token) + "' is not a valid number");
+}
+
+double StringToFigure::parseNumber(const std::string_view token)
+{
+    const std::expected<double, ParseError::Code> value = tryParseNumber(token);
+
+    if (!value.has_value())
+    {
+        throwInvalidNumber(value.error(), token);
+    }
+
+    return *value;
+}
+
+std::expected<double, ParseError::Code> StringToFigure::tryParseNumber(const std::string_view token)
+{
+    const char *first = token.data();
+    const char *const last = token.data() + token.size();
+
+    // std::from_chars rejects a leading '+' and hex prefixes, both of which std::stod accepted
+    const bool negative = first != last && *first == '-';
+    if (first != last && (*first == '+' || *first == '-'))
+    {
+        first++;
+    }
+
+    double value = 0;
+    std::from_chars_result result{first, std::errc::invalid_argument};
+
+    if (first != last && *first != '+' && *first != '-')
+    {
+        if (last - first > 2 && first[0] == '0' && (first[1] == 'x' || first[1] == 'X'))
         {
-            throw std::invalid_argument("'" + temp + "' is not a valid number");
-        } catch (const std::out_of_range &e)
+            result = std::from_chars(first + 2, last, value, std::chars_format::hex);
+        }
+
+        if (result.ec == std::errc::invalid_argument)
         {
-            throw std::invalid_argument("'" + temp + "' can't be stored in a double");
+            result = std::from_chars(first, last, value);
         }
     }
 
-    if (figureName == "triangle")
+    if (result.ec == std::errc::invalid_argument)
     {
-        if (params.size() != 3)
-        {
-            throw std::invalid_argument("Triangle requires three parameters");
-        }
-        return std::make_unique<Triangle>(params.at(0), params.at(1), params.at(2));
+        return std::unexpected(ParseError::INVALID_NUMBER);
     }
 
-    if (figureName == "circle")
+    if (result.ec == std::errc::result_out_of_range || std::fpclassify(value) == FP_SUBNORMAL)
+    {
+        return std::unexpected(ParseError::NUMBER_OUT_OF_RANGE);
+    }
+
+    return negative ? -value : value;
+}
+
+void StringToFigure::checkParamCount(const FigureUtil::FigureType type, const std::size_t paramN)
+{
+    if (paramN == FigureUtil::getFigureParams(type))
+    {
+        return;
+    }
+
+    const unsigned expected = FigureRegistry::params(type);
+    throw std::invalid_argument(std::string(FigureRegistry::displayName(type)) + " requires " +
+                                std::string(COUNT_WORDS[expected]) + (expected == 1 ? " parameter" : " parameters"));
+}
+
+std::unique_ptr<Figure> StringToFigure::createFigure(const FigureUtil::FigureType type,
+                                                     const std::span<const double> params)
+{
+    checkParamCount(type, params.size());
+
+    return FigureRegistry::visit(type, [params]<typename T>() -> std::unique_ptr<Figure> {
+        return std::make_unique<T>(FigureRegistry::make<T>(params));
+    });
+}
+
+std::expected<StringToFigure::Record, StringToFigure::InvalidToken> StringToFigure::parseRecord(
+    std::string_view representation)
+{
+    Record record;
+    record.name = nextToken(representation);
+
+    for (std::string_view token = nextToken(representation); !token.empty(); token = nextToken(representation))
     {
-        if (params.size() != 1)
+        const std::expected<double, ParseError::Code> value = tryParseNumber(token);
+        if (!value.has_value())
         {
-            throw std::invalid_argument("Circle requires one parameter");
+            return std::unexpected(InvalidToken{value.error(), token});
         }
-        return std::make_unique<Circle>(params.at(0));
+
+        if (record.paramN < record.params.size())
+        {
+            record.params[record.paramN] = *value;
+        }
+        record.paramN++;
+    }
+
+    return record;
+}
+
+std::optional<FigureUtil::FigureType> StringToFigure::readRecord(const std::string_view representation,
+                                                                 Record &record)
+{
+    const std::expected<Record, InvalidToken> parsed = parseRecord(representation);
+
+    if (!parsed.has_value())
+    {
+        throwInvalidNumber(parsed.error().code, parsed.error().token);
     }
 
-    if (figureName == "rectangle")
+    record = *parsed;
+    const std::optional<FigureUtil::FigureType> type = parseFigureType(record.name);
+
+    if (type.has_value())
     {
-        if (params.size() != 2)
+        checkParamCount(*type, record.paramN);
+    }
+
+    return type;
+}
+
+PluginFigure StringToFigure::createPluginFigure(const PluginRegistry::TypeId type, const Record &record)
+{
+    // Checked before viewing the parameters, since only the first MAX_RECORD_PARAMS numbers are kept
+    plugins->checkParamCount(type, record.paramN);
+
+    return PluginFigure(*plugins, type, std::span<const double>(record.params).first(record.paramN));
+}
+
+std::unique_ptr<Figure> StringToFigure::createFigure(const std::string_view representation)
+{
+    Record record;
+    const std::optional<FigureUtil::FigureType> type = readRecord(representation, record);
+
+    if (type.has_value())
+    {
+        return createFigure(*type, std::span<const double>(record.params).first(record.paramN));
+    }
+
+    if (const std::optional<PluginRegistry::TypeId> plugin = parsePluginType(record.name))
+    {
+        return std::make_unique<PluginFigure>(createPluginFigure(*plugin, record));
+    }
+
+    return nullptr;
+}
+
+Figure *StringToFigure::createFigure(const FigureUtil::FigureType type, const std::span<const double> params,
+                                     FigureArena &arena)
+{
+    checkParamCount(type, params.size());
+
+    return FigureRegistry::visit(type, [params, &arena]<typename T>() -> Figure * {
+        return arena.make<T>(FigureRegistry::make<T>(params));
+    });
+}
+
+Figure *StringToFigure::createFigure(const std::string_view representation, FigureArena &arena)
+{
+    Record record;
+    const std::optional<FigureUtil::FigureType> type = readRecord(representation, record);
+
+    if (type.has_value())
+    {
+        return createFigure(*type, std::span<const double>(record.params).first(record.paramN), arena);
+    }
+
+    if (const std::optional<PluginRegistry::TypeId> plugin = parsePluginType(record.name))
+    {
+        return arena.make<PluginFigure>(createPluginFigure(*plugin, record));
+    }
+
+    return nullptr;
+}
+
+std::expected<std::unique_ptr<Figure>, ParseError::Code> StringToFigure::tryCreateFigure(
+    const FigureUtil::FigureType type, const std::span<const double> params)
+{
+    if (params.size() != FigureUtil::getFigureParams(type))
+    {
+        return std::unexpected(ParseError::WRONG_PARAMETER_COUNT);
+    }
+
+    return FigureRegistry::visit(type, [params]<typename T>() { return toHandle(FigureRegistry::tryMake<T>(params)); });
+}
+
+std::expected<std::unique_ptr<Figure>, ParseError::Code> StringToFigure::tryCreateFigure(
+    const std::string_view representation)
+{
+    const std::expected<Record, InvalidToken> record = parseRecord(representation);
+
+    if (!record.has_value())
+    {
+        return std::unexpected(record.error().code);
+    }
+
+    const std::optional<FigureUtil::FigureType> type = parseFigureType(record->name);
+
+    if (!type.has_value())
+    {
+        const std::optional<PluginRegistry::TypeId> plugin = parsePluginType(record->name);
+        if (!plugin.has_value())
         {
-            throw std::invalid_argument("Rectangle requires two parameters");
+            return std::unexpected(ParseError::UNKNOWN_FIGURE);
         }
-        return std::make_unique<Rectangle>(params.at(0), params.at(1));
+
+        if (record->paramN != plugins->params(*plugin))
+        {
+            return std::unexpected(ParseError::WRONG_PARAMETER_COUNT);
+        }
+
+        return toHandle(
+            PluginFigure::tryCreate(*plugins, *plugin, std::span<const double>(record->params).first(record->paramN)));
     }
 
-    return nullptr;
+    // Only the first params.size() numbers are kept, so a longer record cannot be viewed as a span
+    if (record->paramN != FigureUtil::getFigureParams(*type))
+    {
+        return std::unexpected(ParseError::WRONG_PARAMETER_COUNT);
+    }
+
+    return tryCreateFigure(*type, std::span<const double>(record->params).first(record->paramN));
 }
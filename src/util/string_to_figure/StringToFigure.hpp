@@ -1,15 +1,85 @@
 #ifndef FIGURES_STRINGTOFIGURE_HPP
 #define FIGURES_STRINGTOFIGURE_HPP
 
-#include <string>
+#include <array>
+#include <expected>
 #include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
 
 #include "../../figure/Figure.hpp"
+#include "../../figure/plugin_figure/PluginFigure.hpp"
+#include "../figure_util/FigureUtil.hpp"
+#include "../parse_error/ParseError.hpp"
+#include "../plugin_registry/PluginRegistry.hpp"
+
+class FigureArena;
 
 class StringToFigure
 {
   public:
-    static std::unique_ptr<Figure> createFigure(const std::string &representation);
+    // Enough room for the parameters of a built-in or a plugin figure
+    static constexpr std::size_t MAX_RECORD_PARAMS = FIGURES_PLUGIN_MAX_PARAMS;
+
+  private:
+    struct Record
+    {
+        std::string_view name;
+        std::array<double, MAX_RECORD_PARAMS> params{};
+        std::size_t paramN = 0;
+    };
+
+    static const PluginRegistry *plugins;
+
+    struct InvalidToken
+    {
+        ParseError::Code code;
+        std::string_view token;
+    };
+
+    [[noreturn]] static void throwInvalidNumber(ParseError::Code code, std::string_view token);
+
+    static void checkParamCount(FigureUtil::FigureType type, std::size_t paramN);
+
+    static std::expected<Record, InvalidToken> parseRecord(std::string_view representation);
+
+    // Throws like createFigure, the type is empty for an unknown figure name
+    static std::optional<FigureUtil::FigureType> readRecord(std::string_view representation, Record &record);
+
+    static PluginFigure createPluginFigure(PluginRegistry::TypeId type, const Record &record);
+
+  public:
+    static std::string_view nextToken(std::string_view &input);
+
+    static std::optional<FigureUtil::FigureType> parseFigureType(std::string_view name);
+
+    // Names that are not built-in figure names are looked up in plugins, which must outlive every parse that may
+    // use them; nullptr turns the fallback off
+    static void setPlugins(const PluginRegistry *plugins);
+    static const PluginRegistry *getPlugins();
+
+    // The plugin type of a name that no built-in figure has
+    static std::optional<PluginRegistry::TypeId> parsePluginType(std::string_view name);
+
+    static bool isFigureName(std::string_view name);
+
+    static double parseNumber(std::string_view token);
+
+    static std::expected<double, ParseError::Code> tryParseNumber(std::string_view token);
+
+    static std::unique_ptr<Figure> createFigure(FigureUtil::FigureType type, std::span<const double> params);
+
+    static std::unique_ptr<Figure> createFigure(std::string_view representation);
+
+    static Figure *createFigure(FigureUtil::FigureType type, std::span<const double> params, FigureArena &arena);
+
+    static Figure *createFigure(std::string_view representation, FigureArena &arena);
+
+    static std::expected<std::unique_ptr<Figure>, ParseError::Code> tryCreateFigure(FigureUtil::FigureType type,
+                                                                                   std::span<const double> params);
+
+    static std::expected<std::unique_ptr<Figure>, ParseError::Code> tryCreateFigure(std::string_view representation);
 };
 
 #endif // FIGURES_STRINGTOFIGURE_HPP
@@ -0,0 +1,23 @@
+#include "ViewTokenizer.hpp"
+
+#include "../string_to_figure/StringToFigure.hpp"
+
+ViewTokenizer::ViewTokenizer(const std::string_view input) : input(input), remaining(input), beforeLast(input)
+{
+}
+
+std::string_view ViewTokenizer::next()
+{
+    beforeLast = remaining;
+    return StringToFigure::nextToken(remaining);
+}
+
+void ViewTokenizer::unread()
+{
+    remaining = beforeLast;
+}
+
+std::size_t ViewTokenizer::getPosition() const
+{
+    return input.size() - remaining.size();
+}
@@ -0,0 +1,24 @@
+#ifndef FIGURES_VIEWTOKENIZER_HPP
+#define FIGURES_VIEWTOKENIZER_HPP
+
+#include <cstddef>
+#include <string_view>
+
+class ViewTokenizer
+{
+  private:
+    std::string_view input;
+    std::string_view remaining;
+    std::string_view beforeLast;
+
+  public:
+    explicit ViewTokenizer(std::string_view input);
+
+    std::string_view next();
+
+    void unread();
+
+    std::size_t getPosition() const;
+};
+
+#endif // FIGURES_VIEWTOKENIZER_HPP
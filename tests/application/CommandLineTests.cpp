@@ -0,0 +1,126 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <string>
+#include <vector>
+
+#include "../../src/application/command_line/CommandLine.hpp"
+
+CommandLine::Options parseArgs(const std::vector<const char *> &args)
+{
+    return CommandLine::parse(args);
+}
+
+TEST_CASE("Command line reads every option", "[CommandLine]")
+{
+    const CommandLine::Options options =
+        parseArgs({"--input", "file:x.txt", "--count", "10", "--op", "stats", "--op", "display", "--save", "out.bin"});
+
+    REQUIRE_FALSE(options.help);
+    REQUIRE(options.input == std::vector<std::string>{"file", "x.txt"});
+    REQUIRE(options.count == 10);
+    REQUIRE(options.operations == std::vector{CommandLine::STATS, CommandLine::DISPLAY});
+    REQUIRE(options.save == "out.bin");
+}
+
+TEST_CASE("Command line splits the input method on colons", "[CommandLine]")
+{
+    REQUIRE(parseArgs({"--input", "parallel:x.txt:4"}).input == std::vector<std::string>{"parallel", "x.txt", "4"});
+    REQUIRE(parseArgs({"--input", "stdin"}).input == std::vector<std::string>{"stdin"});
+    REQUIRE(parseArgs({"--input", "random:7", "--count", "5"}).input == std::vector<std::string>{"random", "7"});
+}
+
+TEST_CASE("Command line loads everything by default", "[CommandLine]")
+{
+    REQUIRE_FALSE(parseArgs({"--input", "binary:x.figb"}).count.has_value());
+    REQUIRE_FALSE(parseArgs({"--input", "binary:x.figb", "--count", "all"}).count.has_value());
+}
+
+TEST_CASE("Command line stops at --help", "[CommandLine]")
+{
+    REQUIRE(parseArgs({"--help", "--bogus"}).help);
+}
+
+TEST_CASE("Command line rejects invalid arguments", "[CommandLine]")
+{
+    REQUIRE_THROWS_WITH(parseArgs({"--bogus"}), "Unknown option: '--bogus'");
+    REQUIRE_THROWS_WITH(parseArgs({"--input"}), "Missing value for '--input'");
+    REQUIRE_THROWS_WITH(parseArgs({"--count", "5"}), "Missing '--input'");
+    REQUIRE_THROWS_WITH(parseArgs({"--input", "stdin", "--count", "-5"}), "Invalid figure count: '-5'");
+    REQUIRE_THROWS_WITH(parseArgs({"--input", "stdin", "--count", "0"}), "Invalid figure count: '0'");
+    REQUIRE_THROWS_WITH(parseArgs({"--input", "stdin", "--op", "sort"}), "Unknown operation: 'sort'");
+    REQUIRE_THROWS_WITH(parseArgs({"--input", "random"}), "Random input needs a '--count'");
+}
+
+TEST_CASE("Command line saves binary files by extension", "[CommandLine]")
+{
+    REQUIRE(CommandLine::isBinaryFile("out.bin"));
+    REQUIRE(CommandLine::isBinaryFile("out.figb"));
+    REQUIRE_FALSE(CommandLine::isBinaryFile("out.txt"));
+}
+
+TEST_CASE("Command line reads streaming and filter options", "[CommandLine]")
+{
+    const CommandLine::Options options =
+        parseArgs({"--input", "random:1", "--count", "5", "--stream", "--type", "circle", "--type", "triangle",
+                   "--min-perimeter", "2.5", "--max-perimeter", "10"});
+
+    REQUIRE(options.stream);
+    REQUIRE(options.filters());
+    REQUIRE(options.types == std::vector{FigureUtil::CIRCLE, FigureUtil::TRIANGLE});
+    REQUIRE(options.minPerimeter == 2.5);
+    REQUIRE(options.maxPerimeter == 10);
+    REQUIRE_FALSE(parseArgs({"--input", "stdin"}).filters());
+}
+
+TEST_CASE("Command line rejects invalid filters", "[CommandLine]")
+{
+    REQUIRE_THROWS_WITH(parseArgs({"--input", "stdin", "--type", "square"}), "Unknown figure type: 'square'");
+    REQUIRE_THROWS_WITH(parseArgs({"--input", "stdin", "--min-perimeter", "x"}), "Invalid perimeter: 'x'");
+    REQUIRE_THROWS_WITH(parseArgs({"--input", "stdin", "--max-perimeter", "-1"}), "Invalid perimeter: '-1'");
+    REQUIRE_THROWS_WITH(parseArgs({"--input", "stdin", "--min-perimeter", "5", "--max-perimeter", "1"}),
+                        "'--min-perimeter' exceeds '--max-perimeter'");
+}
+
+TEST_CASE("Command line reads the display range", "[CommandLine]")
+{
+    const CommandLine::Options options =
+        parseArgs({"--input", "stdin", "--op", "summary", "--op", "display", "--offset", "0", "--limit", "20"});
+
+    REQUIRE(options.operations == std::vector{CommandLine::SUMMARY, CommandLine::DISPLAY});
+    REQUIRE(options.offset == 0);
+    REQUIRE(options.limit == 20);
+
+    REQUIRE_THROWS_WITH(parseArgs({"--input", "stdin", "--offset", "x"}), "Invalid offset: 'x'");
+    REQUIRE_THROWS_WITH(parseArgs({"--input", "stdin", "--limit", "0"}), "Invalid figure count: '0'");
+    REQUIRE_THROWS_WITH(parseArgs({"--input", "random", "--count", "5", "--stream", "--offset", "3"}),
+                        "'--offset' and '--limit' cannot be used with '--stream'");
+}
+
+TEST_CASE("Command line runs each query as an operation", "[CommandLine]")
+{
+    const CommandLine::Options options =
+        parseArgs({"--input", "stdin", "--query", "triangle limit=3", "--op", "stats", "--query", "radius<2"});
+
+    REQUIRE(options.operations == std::vector{CommandLine::QUERY, CommandLine::STATS, CommandLine::QUERY});
+    REQUIRE(options.queries == std::vector<std::string>{"triangle limit=3", "radius<2"});
+    REQUIRE_THROWS_WITH(parseArgs({"--input", "random", "--count", "5", "--stream", "--query", "limit=1"}),
+                        "'--query' cannot be used with '--stream'");
+}
+
+TEST_CASE("Command line sorts the figures as an operation", "[CommandLine]")
+{
+    const CommandLine::Options options = parseArgs({"--input", "stdin", "--sort", "-perimeter", "--op", "display"});
+
+    REQUIRE(options.operations == std::vector{CommandLine::SORT, CommandLine::DISPLAY});
+    REQUIRE(options.sorts == std::vector<std::string>{"-perimeter"});
+    REQUIRE_THROWS_WITH(parseArgs({"--input", "random", "--count", "5", "--stream", "--sort", "type"}),
+                        "'--sort' cannot be used with '--stream'");
+}
+
+TEST_CASE("Command line reads the plugin directory", "[CommandLine]")
+{
+    REQUIRE(parseArgs({"--input", "stdin", "--plugins", "plugins"}).plugins == "plugins");
+    REQUIRE(parseArgs({"--input", "stdin"}).plugins.empty());
+    REQUIRE_THROWS_WITH(parseArgs({"--input", "stdin", "--plugins"}), "Missing value for '--plugins'");
+}
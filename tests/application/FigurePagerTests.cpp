@@ -0,0 +1,71 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+#include "../../src/application/figure_pager/FigurePager.hpp"
+
+FigureStore makePagedStore(const int count)
+{
+    FigureStore store;
+    for (int i = 1; i <= count; i++)
+    {
+        store.add(Circle(i));
+    }
+    return store;
+}
+
+TEST_CASE("Pager splits the figures into numbered pages", "[FigurePager]")
+{
+    const FigureStore store = makePagedStore(5);
+    FigurePager pager(store, 0, std::numeric_limits<std::size_t>::max(), 2);
+
+    REQUIRE(pager.hasNext());
+    REQUIRE(pager.next() == "0. Circle 1\n1. Circle 2\n");
+    REQUIRE(pager.next() == "2. Circle 3\n3. Circle 4\n");
+    REQUIRE(pager.next() == "4. Circle 5\n");
+    REQUIRE_FALSE(pager.hasNext());
+    REQUIRE(pager.getRendered() == 5);
+}
+
+TEST_CASE("Pager honours the offset and limit", "[FigurePager]")
+{
+    const FigureStore store = makePagedStore(10);
+    FigurePager pager(store, 7, 2, 100);
+
+    REQUIRE(pager.next() == "7. Circle 8\n8. Circle 9\n");
+    REQUIRE_FALSE(pager.hasNext());
+}
+
+TEST_CASE("Pager skips removed figures and keeps their numbers", "[FigurePager]")
+{
+    FigureStore store = makePagedStore(5);
+    store.remove(0);
+    store.remove(2);
+
+    FigurePager pager(store, 0, 2, 100);
+
+    REQUIRE(pager.next() == "1. Circle 2\n3. Circle 4\n");
+    REQUIRE(pager.getRendered() == 2);
+}
+
+TEST_CASE("Pager past the end renders nothing", "[FigurePager]")
+{
+    const FigureStore store = makePagedStore(3);
+    const FigurePager pager(store, 3, 10, 100);
+
+    REQUIRE_FALSE(pager.hasNext());
+    REQUIRE_THROWS_WITH(FigurePager(store, 0, 1, 0), "Page size must be between 1 and 1048576");
+}
+
+TEST_CASE("Pager reserves for the figures it can render, not the page size", "[FigurePager]")
+{
+    const FigureStore store = makePagedStore(3);
+
+    REQUIRE_THROWS_AS(FigurePager(store, 0, 2, FigurePager::MAX_PAGE_SIZE + 1), std::invalid_argument);
+
+    FigurePager pager(store, 0, 2, FigurePager::MAX_PAGE_SIZE);
+    REQUIRE(pager.next() == "0. Circle 1\n1. Circle 2\n");
+    REQUIRE_FALSE(pager.hasNext());
+}
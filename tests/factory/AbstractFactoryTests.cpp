@@ -6,6 +6,8 @@
 
 #include "../../src/factory/FigureFactory.hpp"
 #include "../../src/factory/abstract_factory/AbstractFactory.hpp"
+#include "../../src/factory/mmap_figure_factory/MmapFigureFactory.hpp"
+#include "../../src/factory/parallel_figure_factory/ParallelFigureFactory.hpp"
 #include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
 #include "../../src/factory/stream_figure_factory/StreamFigureFactory.hpp"
 
@@ -19,6 +21,11 @@ bool isStreamFigureFactory(const FigureFactory *figfactory)
     return dynamic_cast<const StreamFigureFactory *>(figfactory);
 }
 
+bool isMmapFigureFactory(const FigureFactory *figfactory)
+{
+    return dynamic_cast<const MmapFigureFactory *>(figfactory);
+}
+
 TEST_CASE("Returns nullptr for empty input", "[AbstractFactory]")
 {
     std::vector<std::string> input;
@@ -33,6 +40,23 @@ TEST_CASE("Creates RandomFigureFactory for 'random' input", "[AbstractFactory]")
     REQUIRE(isRandomFigureFactory(AbstractFactory::getFactory(input).get()));
 }
 
+TEST_CASE("Creates a seeded RandomFigureFactory for 'random <seed>' input", "[AbstractFactory]")
+{
+    std::vector<std::string> input = {"random", "12345"};
+    const std::unique_ptr<FigureFactory> factory = AbstractFactory::getFactory(input);
+
+    REQUIRE(dynamic_cast<const RandomFigureFactory &>(*factory).getSeed() == 12345);
+}
+
+TEST_CASE("Throws exception for 'random' with an invalid seed", "[AbstractFactory]")
+{
+    std::vector<std::string> input = {"random", "-1"};
+    REQUIRE_THROWS_WITH(AbstractFactory::getFactory(input), "Invalid seed: '-1'");
+
+    input = {"random", "1", "2"};
+    REQUIRE_THROWS_WITH(AbstractFactory::getFactory(input), "Invalid number of arguments for 'random' choice");
+}
+
 TEST_CASE("Creates StreamFigureFactory for 'stdin' input", "[AbstractFactory]")
 {
     std::vector<std::string> input = {"stdin"};
@@ -40,7 +64,7 @@ TEST_CASE("Creates StreamFigureFactory for 'stdin' input", "[AbstractFactory]")
     REQUIRE(isStreamFigureFactory(AbstractFactory::getFactory(input).get()));
 }
 
-TEST_CASE("Creates StreamFigureFactory with file stream for 'file <filename>' input", "[AbstractFactory]")
+TEST_CASE("Creates MmapFigureFactory for 'file <filename>' input with a regular file", "[AbstractFactory]")
 {
     const std::string filename = "test_input.txt";
 
@@ -52,12 +76,29 @@ TEST_CASE("Creates StreamFigureFactory with file stream for 'file <filename>' in
     {
         std::vector<std::string> input = {"file", filename};
         const std::unique_ptr<FigureFactory> factory = AbstractFactory::getFactory(input);
-        REQUIRE(isStreamFigureFactory(factory.get()));
+        REQUIRE(isMmapFigureFactory(factory.get()));
     }
 
     std::filesystem::remove(filename);
 }
 
+TEST_CASE("Creates a lenient factory for 'file <filename> lenient' input", "[AbstractFactory]")
+{
+    std::vector<std::string> input = {"file", "/dev/null", "lenient"};
+    const std::unique_ptr<FigureFactory> factory = AbstractFactory::getFactory(input);
+
+    REQUIRE(factory->getIngestReport() != nullptr);
+}
+
+TEST_CASE("Creates StreamFigureFactory for 'file <filename>' input that is not a regular file", "[AbstractFactory]")
+{
+    std::vector<std::string> input = {"file", "/dev/null"};
+    const std::unique_ptr<FigureFactory> factory = AbstractFactory::getFactory(input);
+
+    REQUIRE(isStreamFigureFactory(factory.get()));
+    REQUIRE(factory->create() == nullptr);
+}
+
 TEST_CASE("Throws if invalid filename is provide for 'file <filename>' input", "[AbstractFactory]")
 {
     const std::string filename = "test_input.txt";
@@ -76,6 +117,59 @@ TEST_CASE("Throws exception for 'file' without filename or with many filenames",
     REQUIRE_THROWS_WITH(AbstractFactory::getFactory(input), "Invalid number of arguments for 'file' choice");
 }
 
+TEST_CASE("Creates ParallelFigureFactory for 'parallel <filename> [threads]' input", "[AbstractFactory]")
+{
+    const std::string filename = "test_input.txt";
+
+    std::ofstream testFile(filename);
+    testFile << "Circle 5.0\n";
+    testFile.close();
+
+    {
+        std::vector<std::string> input = {"parallel", filename, "3"};
+        const std::unique_ptr<FigureFactory> factory = AbstractFactory::getFactory(input);
+        const auto *parallel = dynamic_cast<const ParallelFigureFactory *>(factory.get());
+
+        REQUIRE(parallel != nullptr);
+        REQUIRE(parallel->getThreads() == 3);
+    }
+
+    {
+        std::vector<std::string> input = {"parallel", filename};
+        REQUIRE(dynamic_cast<const ParallelFigureFactory *>(AbstractFactory::getFactory(input).get()) != nullptr);
+    }
+
+    {
+        std::vector<std::string> input = {"parallel", filename, "zero"};
+        REQUIRE_THROWS_WITH(AbstractFactory::getFactory(input), "Invalid number of threads: 'zero'");
+    }
+
+    {
+        const std::string threads = GENERATE("3abc", "0", "-2", " 3", "");
+        std::vector<std::string> input = {"parallel", filename, threads};
+        REQUIRE_THROWS_WITH(AbstractFactory::getFactory(input), "Invalid number of threads: '" + threads + "'");
+    }
+
+    std::filesystem::remove(filename);
+}
+
+TEST_CASE("Throws exception for 'parallel' with a wrong number of arguments", "[AbstractFactory]")
+{
+    std::vector<std::string> input =
+        GENERATE(values<std::vector<std::string>>({{"parallel"}, {"parallel", "a", "1", "b"}}));
+
+    REQUIRE_THROWS_WITH(AbstractFactory::getFactory(input), "Invalid number of arguments for 'parallel' choice");
+}
+
+TEST_CASE("Throws exception for 'binary' without a single filename", "[AbstractFactory]")
+{
+    std::vector<std::string> input = GENERATE(values<std::vector<std::string>>({{"binary"}, {"binary", "a", "b"}}));
+
+    CAPTURE(input);
+
+    REQUIRE_THROWS_WITH(AbstractFactory::getFactory(input), "Invalid number of arguments for 'binary' choice");
+}
+
 TEST_CASE("Throws exception for unrecognized input type", "[AbstractFactory]")
 {
     std::vector<std::string> input =
@@ -0,0 +1,143 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+
+#include "../../src/factory/binary_figure_factory/BinaryFigureFactory.hpp"
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../../src/util/string_to_figure/StringToFigure.hpp"
+
+void saveBinary(const std::string &filename, const FigureStore &store)
+{
+    std::ofstream file(filename, std::ios::binary);
+    BinaryFigureFormat::write(file, store);
+}
+
+bool sameValues(const FigureStore &expected, const FigureStore &actual)
+{
+    if (expected.size() != actual.size())
+    {
+        return false;
+    }
+
+    for (std::size_t i = 0; i < expected.size(); i++)
+    {
+        if (expected.typeAt(i) != actual.typeAt(i))
+        {
+            return false;
+        }
+    }
+
+    return std::ranges::equal(expected.getTriangleA(), actual.getTriangleA()) &&
+           std::ranges::equal(expected.getTriangleB(), actual.getTriangleB()) &&
+           std::ranges::equal(expected.getTriangleC(), actual.getTriangleC()) &&
+           std::ranges::equal(expected.getCircleRadius(), actual.getCircleRadius()) &&
+           std::ranges::equal(expected.getRectangleWidth(), actual.getRectangleWidth()) &&
+           std::ranges::equal(expected.getRectangleHeight(), actual.getRectangleHeight());
+}
+
+TEST_CASE("Binary round trip preserves every value exactly", "[BinaryFigureFactory]")
+{
+    const std::string filename = "binary_test_roundtrip.figb";
+
+    FigureStore store;
+    store.add(Circle(0.1));
+    store.add(Triangle(1.0 / 3, 1.0 / 3, 1.0 / 3));
+    store.add(Rectangle(std::numeric_limits<double>::min(), std::numeric_limits<double>::max() / 4));
+    RandomFigureFactory().createBatch(1000, store);
+    saveBinary(filename, store);
+
+    BinaryFigureFactory factory(filename);
+    FigureStore loaded;
+
+    REQUIRE(factory.getFigureCount() == store.size());
+    REQUIRE(factory.createBatch(store.size() + 1, loaded) == store.size());
+    REQUIRE(sameValues(store, loaded));
+    REQUIRE(factory.create() == nullptr);
+
+    std::filesystem::remove(filename);
+}
+
+TEST_CASE("Binary round trip keeps figure order after removals", "[BinaryFigureFactory]")
+{
+    const std::string filename = "binary_test_order.figb";
+
+    FigureStore store;
+    store.add(Circle(1));
+    store.add(Circle(2));
+    store.add(Rectangle(3, 4));
+    store.add(Circle(5));
+    store.remove(0);
+    saveBinary(filename, store);
+
+    BinaryFigureFactory factory(filename);
+
+    REQUIRE(factory.create()->toString() == "Circle 2");
+    REQUIRE(factory.create()->toString() == "Rectangle 3 4");
+    REQUIRE(factory.create()->toString() == "Circle 5");
+    REQUIRE(factory.create() == nullptr);
+
+    std::filesystem::remove(filename);
+}
+
+const PluginRegistry &binaryPluginShapes()
+{
+    static const PluginRegistry registry = [] {
+        PluginRegistry loaded;
+        loaded.loadDirectory(FIGURES_PLUGIN_DIR);
+        return loaded;
+    }();
+    return registry;
+}
+
+TEST_CASE("Binary round trip restores plugin figures by type name", "[BinaryFigureFactory]")
+{
+    const std::string filename = "binary_test_plugins.figb";
+    const PluginRegistry &registry = binaryPluginShapes();
+
+    FigureStore store;
+    store.add(PluginFigure(registry, *registry.find("trapezoid"), std::array{10.0, 4.0, 5.0, 5.5}));
+    store.add(Circle(2));
+    store.add(PluginFigure(registry, *registry.find("polygon"), std::array{6.0, 2.0}));
+    store.add(PluginFigure(registry, *registry.find("trapezoid"), std::array{8.0, 4.0, 3.0, 3.0}));
+    saveBinary(filename, store);
+
+    SECTION("The loaded plugins rebuild the figures in order")
+    {
+        StringToFigure::setPlugins(&registry);
+        BinaryFigureFactory factory(filename);
+        FigureStore loaded;
+
+        REQUIRE(factory.createBatch(store.size(), loaded) == store.size());
+        StringToFigure::setPlugins(nullptr);
+
+        REQUIRE(loaded.getPluginFigures().size() == 3);
+        for (std::size_t i = 0; i < store.size(); i++)
+        {
+            REQUIRE(loaded.at(i)->toString() == store.at(i)->toString());
+        }
+    }
+
+    SECTION("Without the plugins the file is refused")
+    {
+        REQUIRE_THROWS_WITH(BinaryFigureFactory(filename),
+                            "Binary figure file needs the plugin figure type 'trapezoid'");
+    }
+
+    std::filesystem::remove(filename);
+}
+
+TEST_CASE("Binary factory rejects a text figure file", "[BinaryFigureFactory]")
+{
+    const std::string filename = "binary_test_text.txt";
+    std::ofstream(filename) << "circle 5\n";
+
+    REQUIRE_THROWS_WITH(BinaryFigureFactory(filename), "Not a binary figure file");
+
+    std::filesystem::remove(filename);
+}
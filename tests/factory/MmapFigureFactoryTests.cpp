@@ -0,0 +1,148 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+
+#include "../../src/factory/mmap_figure_factory/MmapFigureFactory.hpp"
+#include "../../src/store/figure_arena/FigureArena.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+
+constexpr double TOLERANCE = 1e-10;
+
+class TemporaryFile
+{
+  private:
+    std::string filename;
+
+  public:
+    TemporaryFile(std::string filename, const std::string &contents) : filename(std::move(filename))
+    {
+        std::ofstream file(this->filename);
+        file << contents;
+    }
+
+    ~TemporaryFile()
+    {
+        std::filesystem::remove(filename);
+    }
+
+    const std::string &name() const
+    {
+        return filename;
+    }
+};
+
+TEST_CASE("Mapped file figures are created in order", "[MmapFigureFactory]")
+{
+    const TemporaryFile file("mmap_test_input.txt", "circle 5\nRECTANGLE 10 20\n  triangle\t3 4 5");
+    MmapFigureFactory factory(file.name());
+
+    const std::unique_ptr<Figure> circle = factory.create();
+    REQUIRE(circle != nullptr);
+    REQUIRE_THAT(circle->perimeter(), Catch::Matchers::WithinRel(10.0 * M_PI, TOLERANCE));
+
+    const std::unique_ptr<Figure> rectangle = factory.create();
+    REQUIRE(rectangle != nullptr);
+    REQUIRE(rectangle->toString() == "Rectangle 10 20");
+
+    const std::unique_ptr<Figure> triangle = factory.create();
+    REQUIRE(triangle != nullptr);
+    REQUIRE(triangle->toString() == "Triangle 3 4 5");
+
+    REQUIRE(factory.create() == nullptr);
+    REQUIRE(factory.getBytesRead() == std::filesystem::file_size(file.name()));
+}
+
+TEST_CASE("Mapped empty file produces no figures", "[MmapFigureFactory]")
+{
+    const TemporaryFile file("mmap_test_empty.txt", "");
+    MmapFigureFactory factory(file.name());
+
+    REQUIRE(factory.create() == nullptr);
+}
+
+TEST_CASE("Mapped file reports the same errors as a stream", "[MmapFigureFactory]")
+{
+    SECTION("Unknown figure")
+    {
+        const TemporaryFile file("mmap_test_invalid.txt", "Pentagon 5");
+        MmapFigureFactory factory(file.name());
+
+        REQUIRE_THROWS_WITH(factory.create(), "Invalid figure type: 'pentagon'");
+    }
+
+    SECTION("Missing parameter")
+    {
+        const TemporaryFile file("mmap_test_invalid.txt", "rectangle 10");
+        MmapFigureFactory factory(file.name());
+
+        REQUIRE_THROWS_WITH(factory.create(), "Cannot read from input stream!");
+    }
+
+    SECTION("Invalid number")
+    {
+        const TemporaryFile file("mmap_test_invalid.txt", "circle abc");
+        MmapFigureFactory factory(file.name());
+
+        REQUIRE_THROWS_WITH(factory.create(), "'abc' is not a valid number");
+    }
+}
+
+TEST_CASE("Mapping a missing file throws", "[MmapFigureFactory]")
+{
+    REQUIRE_THROWS_WITH(MmapFigureFactory("mmap_test_missing.txt"), "Cannot open file: 'mmap_test_missing.txt'");
+}
+
+TEST_CASE("Mapped file figures are created in batches", "[MmapFigureFactory]")
+{
+    const TemporaryFile file("mmap_test_batch.txt", "circle 5\nrectangle 10 20\ntriangle 3 4 5\n");
+    MmapFigureFactory factory(file.name());
+    FigureStore store;
+
+    REQUIRE(factory.createBatch(2, store) == 2);
+    REQUIRE(factory.createBatch(2, store) == 1);
+    REQUIRE(store.size() == 3);
+    REQUIRE(store.at(2)->toString() == "Triangle 3 4 5");
+}
+
+TEST_CASE("Lenient mapped file skips invalid figures and counts them", "[MmapFigureFactory]")
+{
+    const TemporaryFile file("mmap_test_lenient.txt",
+                             "circle 5\npentagon 1 2\ncircle -1\nrectangle 10\ntriangle 3 4 5\ncircle abc\n");
+    MmapFigureFactory factory(file.name(), true);
+    FigureStore store;
+
+    REQUIRE(factory.createBatch(10, store) == 2);
+    REQUIRE(store.at(0)->toString() == "Circle 5");
+    REQUIRE(store.at(1)->toString() == "Triangle 3 4 5");
+
+    const IngestReport *report = factory.getIngestReport();
+    REQUIRE(report != nullptr);
+    REQUIRE(report->getAccepted() == 2);
+    REQUIRE(report->getRejected() == 4);
+    REQUIRE(report->getRejected(ParseError::UNKNOWN_FIGURE) == 1);
+    REQUIRE(report->getRejected(ParseError::INVALID_RADIUS) == 1);
+    REQUIRE(report->getRejected(ParseError::MISSING_PARAMETER) == 1);
+    REQUIRE(report->getRejected(ParseError::INVALID_NUMBER) == 1);
+}
+
+TEST_CASE("Mapped file figures are built directly in an arena", "[MmapFigureFactory]")
+{
+    const TemporaryFile file("mmap_arena_input.txt", "circle 5\ntriangle 3 4 5\n");
+    MmapFigureFactory factory(file.name());
+    FigureArena arena;
+
+    REQUIRE(factory.createIn(arena)->toString() == "Circle 5");
+    REQUIRE(factory.createIn(arena)->toString() == "Triangle 3 4 5");
+    REQUIRE(factory.createIn(arena) == nullptr);
+    REQUIRE(arena.size() == 2);
+
+    const TemporaryFile invalid("mmap_arena_invalid.txt", "square 1");
+    MmapFigureFactory strict(invalid.name());
+    REQUIRE_THROWS(strict.createIn(arena));
+    REQUIRE(arena.size() == 2);
+}
@@ -0,0 +1,165 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../src/factory/parallel_figure_factory/ParallelFigureFactory.hpp"
+#include "../../src/factory/stream_figure_factory/StreamFigureFactory.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+
+class ParallelTestFile
+{
+  private:
+    std::string filename;
+
+  public:
+    ParallelTestFile(std::string filename, const std::string &contents) : filename(std::move(filename))
+    {
+        std::ofstream file(this->filename);
+        file << contents;
+    }
+
+    ~ParallelTestFile()
+    {
+        std::filesystem::remove(filename);
+    }
+
+    const std::string &name() const
+    {
+        return filename;
+    }
+};
+
+std::string mixedFigures(const int count)
+{
+    std::ostringstream text;
+    for (int i = 1; i <= count; i++)
+    {
+        switch (i % 3)
+        {
+        case 0:
+            text << "Triangle " << i << ' ' << i << "\n " << i << '\n';
+            break;
+        case 1:
+            text << "circle\t" << i << "   ";
+            break;
+        default:
+            text << "RECTANGLE " << i << ' ' << i + 1 << '\n';
+        }
+    }
+    return text.str();
+}
+
+std::vector<std::string> drainToStrings(FigureFactory &factory)
+{
+    std::vector<std::string> figures;
+    while (const std::unique_ptr<Figure> figure = factory.create())
+    {
+        figures.push_back(figure->toString());
+    }
+    return figures;
+}
+
+TEST_CASE("Parallel load returns the same sequence as a serial read", "[ParallelFigureFactory]")
+{
+    const unsigned threads = GENERATE(1u, 2u, 3u, 7u, 64u);
+    const int count = GENERATE(0, 1, 5, 1000);
+    CAPTURE(threads, count);
+
+    const std::string text = mixedFigures(count);
+    const ParallelTestFile file("parallel_test_input.txt", text);
+
+    StreamFigureFactory serial(std::make_unique<std::istringstream>(text));
+    ParallelFigureFactory parallel(file.name(), threads);
+
+    REQUIRE(drainToStrings(parallel) == drainToStrings(serial));
+}
+
+TEST_CASE("Parallel load reports the global index of the first error", "[ParallelFigureFactory]")
+{
+    const unsigned threads = GENERATE(1u, 2u, 4u, 16u);
+    CAPTURE(threads);
+
+    const std::string text = mixedFigures(500) + "circle abc\n" + mixedFigures(500) + "pentagon 5\n";
+    const ParallelTestFile file("parallel_test_error.txt", text);
+
+    ParallelFigureFactory factory(file.name(), threads);
+
+    for (int i = 0; i < 500; i++)
+    {
+        REQUIRE(factory.create() != nullptr);
+    }
+    REQUIRE_THROWS_WITH(factory.create(), "Figure #500: 'abc' is not a valid number");
+}
+
+TEST_CASE("Parallel load matches serial errors for records split across chunks", "[ParallelFigureFactory]")
+{
+    const unsigned threads = GENERATE(1u, 2u, 3u, 5u);
+    CAPTURE(threads);
+
+    const ParallelTestFile file("parallel_test_split.txt", "circle 1 circle triangle 3 4 5 circle 2");
+    ParallelFigureFactory factory(file.name(), threads);
+
+    REQUIRE(factory.create()->toString() == "Circle 1");
+    REQUIRE_THROWS_WITH(factory.create(), "Figure #1: 'triangle' is not a valid number");
+}
+
+TEST_CASE("Parallel factory rejects zero threads", "[ParallelFigureFactory]")
+{
+    const ParallelTestFile file("parallel_test_threads.txt", "circle 1");
+
+    REQUIRE_THROWS_WITH(ParallelFigureFactory(file.name(), 0), "Number of threads must be greater than 0");
+}
+
+TEST_CASE("Parallel load fills batches in file order", "[ParallelFigureFactory]")
+{
+    const std::string text = mixedFigures(100);
+    const ParallelTestFile file("parallel_test_batch.txt", text);
+    ParallelFigureFactory factory(file.name(), 4);
+    StreamFigureFactory serial(std::make_unique<std::istringstream>(text));
+    FigureStore store;
+
+    REQUIRE(factory.create() != nullptr);
+    REQUIRE(factory.createBatch(60, store) == 60);
+    REQUIRE(factory.createBatch(60, store) == 39);
+
+    serial.create();
+    for (std::size_t i = 0; i < store.size(); i++)
+    {
+        REQUIRE(store.at(i)->toString() == serial.create()->toString());
+    }
+}
+
+TEST_CASE("Parallel load hands whole chunks to an empty store in file order", "[ParallelFigureFactory]")
+{
+    const std::string text = mixedFigures(1000);
+    const ParallelTestFile file("parallel_test_whole.txt", text);
+    ParallelFigureFactory factory(file.name(), 4);
+    StreamFigureFactory serial(std::make_unique<std::istringstream>(text));
+    FigureStore store;
+
+    REQUIRE(factory.createBatch(5000, store) == 1000);
+    REQUIRE(factory.create() == nullptr);
+
+    REQUIRE(store.getAggregates().count() == 1000);
+    for (std::size_t i = 0; i < store.size(); i++)
+    {
+        REQUIRE(store.at(i)->toString() == serial.create()->toString());
+    }
+}
+
+TEST_CASE("Parallel batch throws once it reaches the first error", "[ParallelFigureFactory]")
+{
+    const ParallelTestFile file("parallel_test_batch_error.txt", mixedFigures(10) + "circle -1\n" + mixedFigures(10));
+    ParallelFigureFactory factory(file.name(), 3);
+    FigureStore store;
+
+    REQUIRE(factory.createBatch(10, store) == 10);
+    REQUIRE_THROWS_WITH(factory.createBatch(1, store), "Figure #10: Radius must be a finite positive value");
+}
@@ -2,6 +2,8 @@
 #include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 
+#include <algorithm>
+#include <string>
 #include <vector>
 
 #include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
@@ -9,6 +11,8 @@
 #include "../../src/figure/circle/Circle.hpp"
 #include "../../src/figure/rectangle/Rectangle.hpp"
 #include "../../src/figure/triangle/Triangle.hpp"
+#include "../../src/store/figure_arena/FigureArena.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
 
 constexpr double TOLERANCE = 1e-10;
 constexpr int SAMPLE_SIZE = 100;
@@ -264,4 +268,94 @@ TEST_CASE("Factory can create many figures", "[RandomFigureFactory]")
     }
 
     REQUIRE(successCount == LARGE_SAMPLE);
-}
\ No newline at end of file
+}
+
+TEST_CASE("Random factory creates a batch of figures into a store", "[RandomFigureFactory]")
+{
+    RandomFigureFactory factory;
+    FigureStore store;
+    store.add(Circle(1));
+
+    REQUIRE(factory.createBatch(LARGE_SAMPLE, store) == LARGE_SAMPLE);
+    REQUIRE(store.size() == LARGE_SAMPLE + 1);
+
+    for (std::size_t i = 1; i < store.size(); i++)
+    {
+        REQUIRE(store.at(i)->perimeter() > 0);
+    }
+}
+
+TEST_CASE("Random factories with the same seed produce the same figures", "[RandomFigureFactory]")
+{
+    RandomFigureFactory first(42);
+    RandomFigureFactory second(42);
+    RandomFigureFactory other(43);
+
+    bool differs = false;
+    for (int i = 0; i < SAMPLE_SIZE; i++)
+    {
+        const std::string figure = first.create()->toString();
+        REQUIRE(figure == second.create()->toString());
+        differs = differs || figure != other.create()->toString();
+    }
+
+    REQUIRE(differs);
+}
+
+TEST_CASE("Random batches are identical for any thread count", "[RandomFigureFactory]")
+{
+    constexpr std::size_t count = 200'000;
+
+    FigureStore serial;
+    RandomFigureFactory(7, 1).createBatch(count, serial);
+
+    const unsigned threads = GENERATE(2u, 3u, 8u);
+    CAPTURE(threads);
+
+    RandomFigureFactory factory(7, threads);
+    FigureStore parallel;
+    factory.createBatch(count / 2, parallel);
+    factory.createBatch(count - count / 2, parallel);
+
+    REQUIRE(parallel.size() == count);
+    REQUIRE(std::ranges::equal(serial.getTriangleA(), parallel.getTriangleA()));
+    REQUIRE(std::ranges::equal(serial.getTriangleC(), parallel.getTriangleC()));
+    REQUIRE(std::ranges::equal(serial.getCircleRadius(), parallel.getCircleRadius()));
+    REQUIRE(std::ranges::equal(serial.getRectangleHeight(), parallel.getRectangleHeight()));
+    for (std::size_t i = 0; i < count; i += 997)
+    {
+        REQUIRE(serial.typeAt(i) == parallel.typeAt(i));
+    }
+}
+
+TEST_CASE("Random create() follows the same sequence as createBatch()", "[RandomFigureFactory]")
+{
+    RandomFigureFactory single(99);
+    RandomFigureFactory batch(99);
+    FigureStore store;
+
+    batch.createBatch(SAMPLE_SIZE, store);
+
+    for (int i = 0; i < SAMPLE_SIZE; i++)
+    {
+        REQUIRE(single.create()->toString() == store.at(i)->toString());
+    }
+}
+
+TEST_CASE("Random factory rejects zero threads", "[RandomFigureFactory]")
+{
+    REQUIRE_THROWS_WITH(RandomFigureFactory(1, 0), "Number of threads must be greater than 0");
+}
+
+TEST_CASE("Random createIn() follows the same sequence as create()", "[RandomFigureFactory]")
+{
+    RandomFigureFactory heap(99);
+    RandomFigureFactory arenaFactory(99);
+    FigureArena arena;
+
+    for (int i = 0; i < SAMPLE_SIZE; i++)
+    {
+        REQUIRE(arenaFactory.createIn(arena)->toString() == heap.create()->toString());
+    }
+    REQUIRE(arena.size() == SAMPLE_SIZE);
+}
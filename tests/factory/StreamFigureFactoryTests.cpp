@@ -8,6 +8,9 @@
 #include <sstream>
 
 #include "../../src/factory/stream_figure_factory/StreamFigureFactory.hpp"
+#include "../../src/store/figure_arena/FigureArena.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../../src/util/string_to_figure/StringToFigure.hpp"
 
 constexpr double TOLERANCE = 1e-10;
 
@@ -286,4 +289,112 @@ TEST_CASE("Factory handles scientific notation", "[StreamFigureFactory]")
 
         REQUIRE(figure != nullptr);
     }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Stream factory creates a batch of figures into a store", "[StreamFigureFactory]")
+{
+    StreamFigureFactory factory(std::make_unique<std::istringstream>("circle 5\nrectangle 10 20\ntriangle 3 4 5"));
+    FigureStore store;
+
+    SECTION("Batch smaller than the input")
+    {
+        REQUIRE(factory.createBatch(2, store) == 2);
+        REQUIRE(store.size() == 2);
+        REQUIRE(store.at(1)->toString() == "Rectangle 10 20");
+
+        REQUIRE(factory.create()->toString() == "Triangle 3 4 5");
+    }
+
+    SECTION("Batch larger than the input")
+    {
+        REQUIRE(factory.createBatch(10, store) == 3);
+        REQUIRE(store.at(2)->toString() == "Triangle 3 4 5");
+        REQUIRE(factory.getFiguresRead() == 3);
+    }
+}
+
+TEST_CASE("Stream factory batch reports the same errors", "[StreamFigureFactory]")
+{
+    StreamFigureFactory factory(std::make_unique<std::istringstream>("circle 5 rectangle 10"));
+    FigureStore store;
+
+    REQUIRE_THROWS_WITH(factory.createBatch(2, store), "Cannot read from input stream!");
+    REQUIRE(store.size() == 1);
+}
+
+TEST_CASE("Lenient stream factory skips invalid figures", "[StreamFigureFactory]")
+{
+    StreamFigureFactory factory(std::make_unique<std::istringstream>("circle 0 circle 5 junk rectangle 1 x 2 3"),
+                                true);
+
+    REQUIRE(factory.create()->toString() == "Circle 5");
+    REQUIRE(factory.create() == nullptr);
+
+    REQUIRE(factory.getIngestReport()->getRejected(ParseError::INVALID_RADIUS) == 1);
+    REQUIRE(factory.getIngestReport()->getRejected(ParseError::INVALID_NUMBER) == 1);
+    REQUIRE(factory.getFiguresRead() == 1);
+}
+
+TEST_CASE("Strict stream factory has no ingest report", "[StreamFigureFactory]")
+{
+    const StreamFigureFactory factory(std::make_unique<std::istringstream>("circle 5"));
+
+    REQUIRE(factory.getIngestReport() == nullptr);
+}
+
+TEST_CASE("Stream factory builds figures directly in an arena", "[StreamFigureFactory]")
+{
+    StreamFigureFactory factory(std::make_unique<std::istringstream>("circle 5 circle 0 rectangle 1 2"), true);
+    FigureArena arena;
+
+    REQUIRE(factory.createIn(arena)->toString() == "Circle 5");
+    REQUIRE(factory.createIn(arena)->toString() == "Rectangle 1 2");
+    REQUIRE(factory.createIn(arena) == nullptr);
+
+    REQUIRE(arena.size() == 2);
+    REQUIRE(factory.getFiguresRead() == 2);
+    REQUIRE(factory.getIngestReport()->getRejected(ParseError::INVALID_RADIUS) == 1);
+}
+
+// Loads the plugins and turns the plugin fallback of StringToFigure on for one test
+struct StreamPluginFallback
+{
+    PluginRegistry registry;
+
+    StreamPluginFallback()
+    {
+        registry.loadDirectory(FIGURES_PLUGIN_DIR);
+        StringToFigure::setPlugins(&registry);
+    }
+
+    ~StreamPluginFallback()
+    {
+        StringToFigure::setPlugins(nullptr);
+    }
+};
+
+TEST_CASE("Stream factory reads plugin figures once plugins are set", "[StreamFigureFactory]")
+{
+    const StreamPluginFallback fallback;
+
+    SECTION("Strict")
+    {
+        StreamFigureFactory factory(std::make_unique<std::istringstream>("polygon 6 2 circle 1 ellipse 3 2"));
+        FigureStore store;
+
+        REQUIRE(factory.createBatch(3, store) == 3);
+        REQUIRE(store.getAggregates().pluginCount() == 2);
+        REQUIRE(store.at(0)->toString() == "Polygon 6 2");
+        REQUIRE(store.at(2)->toString() == "Ellipse 3 2");
+    }
+
+    SECTION("Lenient")
+    {
+        StreamFigureFactory factory(std::make_unique<std::istringstream>("polygon 2.5 2 trapezoid 1 polygon 6 2"),
+                                    true);
+
+        REQUIRE(factory.create()->toString() == "Polygon 6 2");
+        REQUIRE(factory.getIngestReport()->getRejected(ParseError::INVALID_PLUGIN_FIGURE) == 1);
+        REQUIRE(factory.getIngestReport()->getRejected(ParseError::MISSING_PARAMETER) == 1);
+    }
+}
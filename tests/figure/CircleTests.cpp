@@ -86,4 +86,15 @@ TEST_CASE("Circle constructor detects arithmetic overflow of perimeter", "[Circl
 {
     constexpr double large = std::numeric_limits<double>::max();
     REQUIRE_THROWS_WITH(Circle(large), "Perimeter must be a finite positive value");
-}
\ No newline at end of file
+}
+
+TEST_CASE("Circle tryCreate reports invalid radius without throwing", "[Circle]")
+{
+    const std::expected<Circle, ParseError::Code> valid = Circle::tryCreate(5);
+    REQUIRE(valid.has_value());
+    REQUIRE(valid->getRadius() == 5);
+
+    REQUIRE(Circle::tryCreate(-1).error() == ParseError::INVALID_RADIUS);
+    REQUIRE(Circle::tryCreate(std::numeric_limits<double>::quiet_NaN()).error() == ParseError::INVALID_RADIUS);
+    REQUIRE(Circle::tryCreate(std::numeric_limits<double>::max()).error() == ParseError::INVALID_PERIMETER);
+}
@@ -0,0 +1,56 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include "../../src/figure/figure_value/FigureValue.hpp"
+#include "../../src/util/figure_hash/FigureHash.hpp"
+
+constexpr double VALUE_TOLERANCE = 1e-12;
+
+TEST_CASE("Figure values match the figures they were made from", "[FigureValue]")
+{
+    const std::vector<std::shared_ptr<Figure>> figures = {
+        std::make_shared<Triangle>(3, 4, 5), std::make_shared<Circle>(2.5), std::make_shared<Rectangle>(10, 20)};
+
+    for (const std::shared_ptr<Figure> &figure : figures)
+    {
+        const FigureValue value(*figure);
+
+        REQUIRE(value.getType() == figure->getType());
+        REQUIRE_THAT(value.perimeter(), Catch::Matchers::WithinRel(figure->perimeter(), VALUE_TOLERANCE));
+        REQUIRE(value.toString() == figure->toString());
+        REQUIRE(value.hash() == FigureHash::hash(*figure));
+        REQUIRE(value.toFigure()->toString() == figure->toString());
+    }
+}
+
+TEST_CASE("Figure values are plain data in a contiguous vector", "[FigureValue]")
+{
+    std::vector<FigureValue> values;
+    values.emplace_back(Circle(1));
+    values.emplace_back(Rectangle(1, 2));
+    values.push_back(values[0]);
+
+    REQUIRE(values[2] == values[0]);
+    REQUIRE_FALSE(values[1] == values[0]);
+    REQUIRE(std::get<FigureValue::RectangleData>(values[1].getData()).height == 2);
+    REQUIRE_THAT(values[2].perimeter(), Catch::Matchers::WithinRel(2 * M_PI, VALUE_TOLERANCE));
+
+    values[0] = FigureValue(Triangle(3, 4, 5));
+    REQUIRE(values[0].getType() == FigureUtil::TRIANGLE);
+}
+
+TEST_CASE("Figure values are created only from valid parameters", "[FigureValue]")
+{
+    REQUIRE(FigureValue::tryCreate(FigureUtil::TRIANGLE, std::array{3.0, 4.0, 5.0})->toString() == "Triangle 3 4 5");
+    REQUIRE(FigureValue::tryCreate(FigureUtil::TRIANGLE, std::array{1.0, 2.0, 10.0}).error() ==
+            ParseError::INVALID_TRIANGLE);
+    REQUIRE(FigureValue::tryCreate(FigureUtil::CIRCLE, std::array{-1.0}).error() == ParseError::INVALID_RADIUS);
+    REQUIRE(FigureValue::tryCreate(FigureUtil::RECTANGLE, std::array{1.0}).error() ==
+            ParseError::WRONG_PARAMETER_COUNT);
+}
@@ -0,0 +1,118 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <memory_resource>
+#include <stdexcept>
+
+#include "../../src/figure/plugin_figure/PluginFigure.hpp"
+#include "../../src/store/figure_arena/FigureArena.hpp"
+#include "../../src/util/figure_hash/FigureHash.hpp"
+#include "../../src/util/string_to_figure/StringToFigure.hpp"
+
+const PluginRegistry &pluginFigureShapes()
+{
+    static const PluginRegistry registry = [] {
+        PluginRegistry loaded;
+        loaded.loadDirectory(FIGURES_PLUGIN_DIR);
+        return loaded;
+    }();
+    return registry;
+}
+
+// Turns the plugin fallback of StringToFigure on for one test
+struct PluginFigureFallback
+{
+    PluginFigureFallback()
+    {
+        StringToFigure::setPlugins(&pluginFigureShapes());
+    }
+
+    ~PluginFigureFallback()
+    {
+        StringToFigure::setPlugins(nullptr);
+    }
+};
+
+TEST_CASE("Plugin figure measures and formats through its plugin", "[PluginFigure]")
+{
+    const PluginRegistry &registry = pluginFigureShapes();
+    const PluginFigure polygon(registry, *registry.find("polygon"), std::array{6.0, 2.0});
+
+    REQUIRE(polygon.perimeter() == 12);
+    REQUIRE(polygon.toString() == "Polygon 6 2");
+    REQUIRE(polygon.getParams().size() == 2);
+    REQUIRE_THROWS_WITH(polygon.getType(), "Figure type 'polygon' comes from a plugin");
+}
+
+TEST_CASE("Plugin figure rejects parameters its plugin rejects", "[PluginFigure]")
+{
+    const PluginRegistry &registry = pluginFigureShapes();
+    const PluginRegistry::TypeId polygon = *registry.find("polygon");
+
+    REQUIRE_THROWS_WITH(PluginFigure(registry, polygon, std::array{6.0}),
+                        "Figure type 'polygon' requires 2 parameters");
+    REQUIRE_THROWS_AS(PluginFigure(registry, polygon, std::array{2.5, 2.0}), std::invalid_argument);
+
+    REQUIRE(PluginFigure::tryCreate(registry, polygon, std::array{6.0}).error() == ParseError::WRONG_PARAMETER_COUNT);
+    REQUIRE(PluginFigure::tryCreate(registry, polygon, std::array{2.5, 2.0}).error() ==
+            ParseError::INVALID_PLUGIN_FIGURE);
+    REQUIRE(PluginFigure::tryCreate(registry, polygon, std::array{6.0, 2.0}).has_value());
+}
+
+TEST_CASE("Plugin figure clones keep the type and parameters", "[PluginFigure]")
+{
+    const PluginRegistry &registry = pluginFigureShapes();
+    const PluginFigure ellipse(registry, *registry.find("ellipse"), std::array{3.0, 2.0});
+
+    const std::unique_ptr<Figure> cloned(ellipse.clone());
+    REQUIRE(cloned->toString() == ellipse.toString());
+    REQUIRE(cloned->perimeter() == ellipse.perimeter());
+
+    std::pmr::monotonic_buffer_resource resource;
+    const Figure *arenaCopy = ellipse.clone(resource);
+    REQUIRE(arenaCopy->toString() == "Ellipse 3 2");
+}
+
+TEST_CASE("Plugin figures hash by type name and parameters", "[PluginFigure]")
+{
+    const PluginRegistry &registry = pluginFigureShapes();
+    const PluginFigure polygon(registry, *registry.find("polygon"), std::array{4.0, 2.0});
+    const PluginFigure ellipse(registry, *registry.find("ellipse"), std::array{4.0, 2.0});
+
+    REQUIRE(FigureHash::hash(polygon) == FigureHash::hashPlugin("polygon", std::array{4.0, 2.0}));
+    REQUIRE(FigureHash::hash(polygon) != FigureHash::hash(ellipse));
+}
+
+TEST_CASE("StringToFigure falls back to plugin figure names", "[PluginFigure]")
+{
+    SECTION("Without plugins the name is unknown")
+    {
+        REQUIRE_FALSE(StringToFigure::isFigureName("polygon"));
+        REQUIRE(StringToFigure::createFigure("polygon 6 2") == nullptr);
+        REQUIRE(StringToFigure::tryCreateFigure("polygon 6 2").error() == ParseError::UNKNOWN_FIGURE);
+    }
+
+    SECTION("With plugins the plugin builds the figure")
+    {
+        const PluginFigureFallback fallback;
+
+        REQUIRE(StringToFigure::isFigureName("Polygon"));
+        REQUIRE(StringToFigure::isFigureName("circle"));
+        REQUIRE_FALSE(StringToFigure::parsePluginType("circle").has_value());
+
+        const std::unique_ptr<Figure> figure = StringToFigure::createFigure("TRAPEZOID 10 4 5 5.5");
+        REQUIRE(figure->toString() == "Trapezoid 10 4 5 5.5");
+        REQUIRE(figure->perimeter() == 24.5);
+
+        FigureArena arena;
+        REQUIRE(StringToFigure::createFigure("ellipse 1 1", arena)->toString() == "Ellipse 1 1");
+
+        REQUIRE(StringToFigure::tryCreateFigure("polygon 6").error() == ParseError::WRONG_PARAMETER_COUNT);
+        REQUIRE(StringToFigure::tryCreateFigure("polygon 2.5 2").error() == ParseError::INVALID_PLUGIN_FIGURE);
+        REQUIRE(StringToFigure::tryCreateFigure("polygon 6 2").has_value());
+    }
+}
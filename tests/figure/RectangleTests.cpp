@@ -106,4 +106,15 @@ TEST_CASE("Rectangle constructor detects arithmetic overflow of perimeter", "[Re
 {
     constexpr double large = std::numeric_limits<double>::max() / 2;
     REQUIRE_THROWS_WITH(Rectangle(large, large), "Perimeter must be a finite positive value");
-}
\ No newline at end of file
+}
+
+TEST_CASE("Rectangle tryCreate reports invalid dimensions without throwing", "[Rectangle]")
+{
+    const std::expected<Rectangle, ParseError::Code> valid = Rectangle::tryCreate(10, 20);
+    REQUIRE(valid.has_value());
+    REQUIRE(valid->perimeter() == 60);
+
+    REQUIRE(Rectangle::tryCreate(0, 20).error() == ParseError::INVALID_WIDTH);
+    REQUIRE(Rectangle::tryCreate(10, -1).error() == ParseError::INVALID_HEIGHT);
+    REQUIRE(Rectangle::tryCreate(std::numeric_limits<double>::max(), 1).error() == ParseError::INVALID_PERIMETER);
+}
@@ -0,0 +1,102 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../../src/figure/circle/Circle.hpp"
+#include "../../src/figure/plugin_figure/PluginFigure.hpp"
+#include "../../src/figure/rectangle/Rectangle.hpp"
+#include "../../src/figure/shared_figure/SharedFigure.hpp"
+#include "../../src/figure/triangle/Triangle.hpp"
+
+TEST_CASE("Shared figure copies share one payload", "[SharedFigure]")
+{
+    const SharedFigure original = SharedFigure::make<Rectangle>(2, 3);
+    REQUIRE(original.useCount() == 1);
+
+    {
+        const SharedFigure copy = original;
+        std::vector<SharedFigure> more(3, copy);
+
+        REQUIRE(copy.get() == original.get());
+        REQUIRE(original.useCount() == 5);
+        REQUIRE(more[2]->toString() == "Rectangle 2 3");
+    }
+
+    REQUIRE(original.useCount() == 1);
+}
+
+TEST_CASE("Shared figure moves and assignments keep the count right", "[SharedFigure]")
+{
+    SharedFigure circle = SharedFigure::make<Circle>(1);
+    SharedFigure triangle(Triangle(3, 4, 5));
+
+    SharedFigure moved = std::move(circle);
+    REQUIRE_FALSE(circle);
+    REQUIRE(circle.useCount() == 0);
+    REQUIRE(moved.useCount() == 1);
+
+    circle = triangle;
+    REQUIRE(triangle.useCount() == 2);
+    REQUIRE(circle->toString() == "Triangle 3 4 5");
+
+    triangle = moved;
+    REQUIRE(circle.useCount() == 1);
+    REQUIRE(moved.useCount() == 2);
+    REQUIRE((*triangle).getType() == FigureUtil::CIRCLE);
+
+    triangle = triangle;
+    REQUIRE(moved.useCount() == 2);
+}
+
+TEST_CASE("Shared figure still deep copies through Clonable", "[SharedFigure]")
+{
+    const SharedFigure shared(Circle(2.5));
+
+    const std::unique_ptr<Figure> copy = shared.deepCopy();
+
+    REQUIRE(copy.get() != shared.get());
+    REQUIRE(copy->toString() == "Circle 2.5");
+    REQUIRE(shared.useCount() == 1);
+}
+
+TEST_CASE("Shared figure holds a plugin figure", "[SharedFigure]")
+{
+    static const PluginRegistry registry = [] {
+        PluginRegistry loaded;
+        loaded.loadDirectory(FIGURES_PLUGIN_DIR);
+        return loaded;
+    }();
+
+    const SharedFigure shared(PluginFigure(registry, *registry.find("polygon"), std::array{6.0, 2.0}));
+    const SharedFigure copy = shared;
+
+    REQUIRE(copy.get() == shared.get());
+    REQUIRE(copy->toString() == "Polygon 6 2");
+    REQUIRE(shared.deepCopy()->perimeter() == 12);
+}
+
+TEST_CASE("Atomic shared figure can be copied on several threads", "[SharedFigure]")
+{
+    const AtomicSharedFigure shared = AtomicSharedFigure::make<Circle>(1);
+
+    std::vector<std::thread> workers;
+    for (int t = 0; t < 4; t++)
+    {
+        workers.emplace_back([&shared] {
+            for (int i = 0; i < 10'000; i++)
+            {
+                std::vector<AtomicSharedFigure> copies(10, shared);
+            }
+        });
+    }
+
+    for (std::thread &worker : workers)
+    {
+        worker.join();
+    }
+
+    REQUIRE(shared.useCount() == 1);
+}
@@ -124,4 +124,16 @@ TEST_CASE("Triangle constructor detects arithmetic overflow of perimeter", "[Tri
 {
     constexpr double large = std::numeric_limits<double>::max() / 2;
     REQUIRE_THROWS_WITH(Triangle(large, large, large), "Perimeter must be a finite positive value");
-}
\ No newline at end of file
+}
+
+TEST_CASE("Triangle tryCreate reports invalid sides without throwing", "[Triangle]")
+{
+    const std::expected<Triangle, ParseError::Code> valid = Triangle::tryCreate(3, 4, 5);
+    REQUIRE(valid.has_value());
+    REQUIRE(valid->perimeter() == 12);
+
+    REQUIRE(Triangle::tryCreate(-3, 4, 5).error() == ParseError::INVALID_SIDE_A);
+    REQUIRE(Triangle::tryCreate(3, 0, 5).error() == ParseError::INVALID_SIDE_B);
+    REQUIRE(Triangle::tryCreate(3, 4, std::numeric_limits<double>::infinity()).error() == ParseError::INVALID_SIDE_C);
+    REQUIRE(Triangle::tryCreate(1, 2, 10).error() == ParseError::INVALID_TRIANGLE);
+}
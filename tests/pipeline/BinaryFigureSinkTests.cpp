@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+
+#include "../../src/factory/binary_figure_factory/BinaryFigureFactory.hpp"
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/pipeline/binary_figure_sink/BinaryFigureSink.hpp"
+#include "../../src/pipeline/figure_pipeline/FigurePipeline.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../../src/util/string_to_figure/StringToFigure.hpp"
+
+std::string readFileBytes(const std::string &filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+TEST_CASE("Streamed binary file matches a bulk save byte for byte", "[BinaryFigureSink]")
+{
+    const std::string filename = "binary_sink_test.figb";
+    constexpr std::size_t count = 5000;
+
+    FigureStore store;
+    RandomFigureFactory(7).createBatch(count, store);
+    std::ostringstream expected;
+    BinaryFigureFormat::write(expected, store);
+
+    RandomFigureFactory source(7);
+    FigurePipeline pipeline(700);
+    pipeline.addSink(std::make_unique<BinaryFigureSink>(filename));
+    REQUIRE(pipeline.run(source, count) == count);
+
+    REQUIRE(readFileBytes(filename) == expected.str());
+
+    BinaryFigureFactory factory(filename);
+    FigureStore loaded;
+    REQUIRE(factory.createBatch(count, loaded) == count);
+    REQUIRE(loaded.at(count - 1)->toString() == store.at(count - 1)->toString());
+
+    std::filesystem::remove(filename);
+}
+
+TEST_CASE("Streamed plugin figures match a bulk save byte for byte", "[BinaryFigureSink]")
+{
+    const std::string filename = "binary_sink_plugins.figb";
+    static const PluginRegistry registry = [] {
+        PluginRegistry loaded;
+        loaded.loadDirectory(FIGURES_PLUGIN_DIR);
+        return loaded;
+    }();
+
+    FigureStore first;
+    first.add(PluginFigure(registry, *registry.find("polygon"), std::array{6.0, 2.0}));
+    first.add(Circle(1));
+    FigureStore second;
+    second.add(PluginFigure(registry, *registry.find("ellipse"), std::array{3.0, 2.0}));
+    second.add(PluginFigure(registry, *registry.find("polygon"), std::array{5.0, 1.0}));
+
+    FigureStore whole;
+    whole.append(first);
+    whole.append(second);
+    std::ostringstream expected;
+    BinaryFigureFormat::write(expected, whole);
+
+    {
+        BinaryFigureSink sink(filename);
+        sink.write(first);
+        sink.write(second);
+        sink.finish();
+    }
+    REQUIRE(readFileBytes(filename) == expected.str());
+
+    StringToFigure::setPlugins(&registry);
+    BinaryFigureFactory factory(filename);
+    FigureStore loaded;
+    REQUIRE(factory.createBatch(whole.size(), loaded) == whole.size());
+    StringToFigure::setPlugins(nullptr);
+    REQUIRE(loaded.at(2)->toString() == "Ellipse 3 2");
+
+    std::filesystem::remove(filename);
+}
+
+TEST_CASE("Streaming no figures writes an empty binary file", "[BinaryFigureSink]")
+{
+    const std::string filename = "binary_sink_empty.figb";
+    {
+        BinaryFigureSink sink(filename);
+        sink.finish();
+    }
+
+    REQUIRE(BinaryFigureFactory(filename).getFigureCount() == 0);
+
+    std::filesystem::remove(filename);
+}
+
+TEST_CASE("Binary sink reports a file it cannot open", "[BinaryFigureSink]")
+{
+    REQUIRE_THROWS_WITH(BinaryFigureSink("missing_dir/out.figb"), "Cannot open file: 'missing_dir/out.figb'");
+}
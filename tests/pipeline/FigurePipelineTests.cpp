@@ -0,0 +1,63 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <memory>
+#include <sstream>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/factory/stream_figure_factory/StreamFigureFactory.hpp"
+#include "../../src/pipeline/aggregate_stage/AggregateStage.hpp"
+#include "../../src/pipeline/figure_pipeline/FigurePipeline.hpp"
+#include "../../src/pipeline/text_figure_sink/TextFigureSink.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+
+TEST_CASE("Pipeline streams the same figures as a bulk load", "[FigurePipeline]")
+{
+    constexpr std::size_t count = 10'500;
+
+    FigureStore store;
+    RandomFigureFactory(42).createBatch(count, store);
+    std::ostringstream expected;
+    TextFigureSink bulkSink(expected, true);
+    bulkSink.write(store);
+    bulkSink.finish();
+
+    RandomFigureFactory source(42);
+    std::ostringstream streamed;
+    FigurePipeline pipeline(1000);
+    const auto &aggregate = static_cast<const AggregateStage &>(pipeline.addStage(std::make_unique<AggregateStage>()));
+    pipeline.addSink(std::make_unique<TextFigureSink>(streamed, true));
+
+    REQUIRE(pipeline.run(source, count) == count);
+    REQUIRE(streamed.str() == expected.str());
+
+    const FigureAggregates &aggregates = aggregate.getAggregates();
+    REQUIRE(aggregates.count() == count);
+    REQUIRE(aggregates.count(FigureUtil::TRIANGLE) == store.getTriangleA().size());
+    REQUIRE(aggregates.count(FigureUtil::CIRCLE) == store.getCircleRadius().size());
+    REQUIRE(aggregates.count(FigureUtil::RECTANGLE) == store.getRectangleWidth().size());
+
+    double sum = 0;
+    for (std::size_t i = 0; i < store.size(); i++)
+    {
+        sum += store.at(i)->perimeter();
+    }
+    REQUIRE_THAT(aggregates.perimeterSum(), Catch::Matchers::WithinRel(sum, 1e-12));
+}
+
+TEST_CASE("Pipeline stops when the source runs dry", "[FigurePipeline]")
+{
+    StreamFigureFactory source(std::make_unique<std::istringstream>("circle 1\nrectangle 2 3\ntriangle 3 4 5\n"));
+    std::ostringstream output;
+    FigurePipeline pipeline(2);
+    pipeline.addSink(std::make_unique<TextFigureSink>(output, false));
+
+    REQUIRE(pipeline.run(source, 10) == 3);
+    REQUIRE(output.str() == "Circle 1\nRectangle 2 3\nTriangle 3 4 5\n");
+}
+
+TEST_CASE("Pipeline rejects an empty chunk size", "[FigurePipeline]")
+{
+    REQUIRE_THROWS_WITH(FigurePipeline(0), "Pipeline chunk size must be positive");
+}
@@ -0,0 +1,60 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <vector>
+
+#include "../../src/pipeline/filter_stage/FilterStage.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+
+FigureStore makeFilterInput()
+{
+    FigureStore store;
+    store.add(Circle(1));
+    store.add(Rectangle(1, 2));
+    store.add(Triangle(3, 4, 5));
+    store.add(Rectangle(10, 20));
+    store.add(Circle(10));
+    return store;
+}
+
+TEST_CASE("Filter keeps every figure by default", "[FilterStage]")
+{
+    FigureStore store = makeFilterInput();
+
+    FilterStage().process(store);
+
+    REQUIRE(store.size() == 5);
+}
+
+TEST_CASE("Filter keeps only the selected types in order", "[FilterStage]")
+{
+    FigureStore store = makeFilterInput();
+    FilterStage filter;
+    filter.setTypes(std::vector{FigureUtil::RECTANGLE, FigureUtil::TRIANGLE});
+
+    filter.process(store);
+
+    REQUIRE(store.size() == 3);
+    REQUIRE(store.at(0)->toString() == "Rectangle 1 2");
+    REQUIRE(store.at(1)->toString() == "Triangle 3 4 5");
+    REQUIRE(store.at(2)->toString() == "Rectangle 10 20");
+}
+
+TEST_CASE("Filter keeps perimeters within an inclusive range", "[FilterStage]")
+{
+    FigureStore store = makeFilterInput();
+    FilterStage filter;
+    filter.setPerimeterRange(6, 12);
+
+    filter.process(store);
+
+    REQUIRE(store.size() == 3);
+    REQUIRE(store.at(0)->toString() == "Circle 1");
+    REQUIRE(store.at(1)->toString() == "Rectangle 1 2");
+    REQUIRE(store.at(2)->toString() == "Triangle 3 4 5");
+}
+
+TEST_CASE("Filter rejects an inverted perimeter range", "[FilterStage]")
+{
+    REQUIRE_THROWS_WITH(FilterStage().setPerimeterRange(2, 1),
+                        "Minimum perimeter must not exceed the maximum perimeter");
+}
@@ -0,0 +1,92 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/query/figure_query/FigureQuery.hpp"
+
+using Numbers = std::vector<std::size_t>;
+
+FigureStore makeQueryStore()
+{
+    FigureStore store;
+    store.add(Circle(1));         // 0: perimeter 6.28
+    store.add(Rectangle(1, 2));   // 1: 6
+    store.add(Triangle(3, 4, 5)); // 2: 12
+    store.add(Rectangle(10, 20)); // 3: 60
+    store.add(Circle(10));        // 4: 62.8
+    store.add(Triangle(1, 1, 1)); // 5: 3
+    return store;
+}
+
+TEST_CASE("Empty query returns every figure in number order", "[FigureQuery]")
+{
+    FigureStore store = makeQueryStore();
+    store.remove(1);
+
+    REQUIRE(FigureQuery::parse("").execute(store) == Numbers{0, 2, 3, 4, 5});
+}
+
+TEST_CASE("Query filters by type and predicates", "[FigureQuery]")
+{
+    const FigureStore store = makeQueryStore();
+
+    REQUIRE(FigureQuery::parse("triangle").execute(store) == Numbers{2, 5});
+    REQUIRE(FigureQuery::parse("circle rectangle perimeter>=6.1").execute(store) == Numbers{0, 3, 4});
+    REQUIRE(FigureQuery::parse("perimeter>5 perimeter<20").execute(store) == Numbers{0, 1, 2});
+    REQUIRE(FigureQuery::parse("radius=10").execute(store) == Numbers{4});
+    REQUIRE(FigureQuery::parse("height<=2").execute(store) == Numbers{1});
+    REQUIRE(FigureQuery::parse("a>1 c=5").execute(store) == Numbers{2});
+    REQUIRE(FigureQuery::parse("circle width>0").execute(store).empty());
+}
+
+TEST_CASE("Query sorts and keeps the first results", "[FigureQuery]")
+{
+    const FigureStore store = makeQueryStore();
+
+    REQUIRE(FigureQuery::parse("sort=perimeter").execute(store) == Numbers{5, 1, 0, 2, 3, 4});
+    REQUIRE(FigureQuery::parse("sort=-perimeter limit=2").execute(store) == Numbers{4, 3});
+    REQUIRE(FigureQuery::parse("sort=-number limit=3").execute(store) == Numbers{5, 4, 3});
+    REQUIRE(FigureQuery::parse("limit=2").execute(store) == Numbers{0, 1});
+    REQUIRE(FigureQuery::parse("sort=radius").execute(store) == Numbers{0, 4});
+}
+
+TEST_CASE("Parallel query matches the sequential result", "[FigureQuery]")
+{
+    FigureStore store;
+    RandomFigureFactory(21).createBatch(300'000, store);
+    for (std::size_t i = 0; i < store.slotCount(); i += 7)
+    {
+        store.remove(i);
+    }
+
+    for (const char *text : {"triangle sort=-perimeter limit=50", "sort=perimeter limit=1000", "circle limit=10",
+                             "rectangle width>1e307 sort=-height", "perimeter<1e307"})
+    {
+        const FigureQuery query = FigureQuery::parse(text);
+        REQUIRE(query.execute(store, 4) == query.execute(store, 1));
+    }
+}
+
+TEST_CASE("Top-k query agrees with a full sort", "[FigureQuery]")
+{
+    FigureStore store;
+    RandomFigureFactory(22).createBatch(20'000, store);
+
+    Numbers all = FigureQuery::parse("sort=-perimeter").execute(store);
+    all.resize(25);
+
+    REQUIRE(FigureQuery::parse("sort=-perimeter limit=25").execute(store) == all);
+}
+
+TEST_CASE("Query parser rejects malformed terms", "[FigureQuery]")
+{
+    REQUIRE_THROWS_WITH(FigureQuery::parse("square"), "Invalid query term: 'square'");
+    REQUIRE_THROWS_WITH(FigureQuery::parse("area>5"), "Unknown query field: 'area'");
+    REQUIRE_THROWS_WITH(FigureQuery::parse("perimeter>x"), "Invalid query value: 'x'");
+    REQUIRE_THROWS_WITH(FigureQuery::parse("perimeter<="), "Invalid query value: ''");
+    REQUIRE_THROWS_WITH(FigureQuery::parse("limit=0"), "Invalid query limit: '0'");
+    REQUIRE_THROWS_WITH(FigureQuery::parse("sort=-size"), "Unknown query field: 'size'");
+    REQUIRE_THROWS_WITH(FigureQuery().execute(FigureStore(), 0), "Number of threads must be greater than 0");
+}
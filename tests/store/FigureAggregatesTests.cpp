@@ -0,0 +1,210 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include "../../src/figure/circle/Circle.hpp"
+#include "../../src/figure/rectangle/Rectangle.hpp"
+#include "../../src/figure/triangle/Triangle.hpp"
+#include "../../src/store/figure_aggregates/FigureAggregates.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+
+constexpr double AGGREGATE_TOLERANCE = 1e-12;
+
+TEST_CASE("Empty store has empty aggregates", "[FigureAggregates]")
+{
+    const FigureAggregates &aggregates = FigureStore().getAggregates();
+
+    REQUIRE(aggregates.count() == 0);
+    REQUIRE(aggregates.perimeterSum() == 0);
+    REQUIRE(aggregates.meanPerimeter() == 0);
+    REQUIRE(aggregates.minPerimeter() == std::numeric_limits<double>::infinity());
+}
+
+TEST_CASE("Store aggregates follow adds, clones and removals", "[FigureAggregates]")
+{
+    FigureStore store;
+    store.add(Triangle(3, 4, 5));
+    store.add(Circle(1));
+    store.add(Rectangle(10, 20));
+    store.add(Rectangle(1, 2));
+
+    REQUIRE(store.getAggregates().count() == 4);
+    REQUIRE(store.getAggregates().count(FigureUtil::RECTANGLE) == 2);
+    REQUIRE(store.getAggregates().minPerimeter() == 6);
+    REQUIRE(store.getAggregates().maxPerimeter() == 60);
+
+    store.clone(2);
+    REQUIRE(store.getAggregates().count(FigureUtil::RECTANGLE) == 3);
+    REQUIRE_THAT(store.getAggregates().perimeterSum(), Catch::Matchers::WithinRel(12 + 2 * M_PI + 60 + 6 + 60,
+                                                                                  AGGREGATE_TOLERANCE));
+
+    SECTION("Removing a figure inside the range keeps the extremes")
+    {
+        store.remove(0);
+
+        REQUIRE_FALSE(store.getAggregates().isStale());
+        REQUIRE(store.getAggregates().count(FigureUtil::TRIANGLE) == 0);
+        REQUIRE_THAT(store.getAggregates().meanPerimeter(),
+                     Catch::Matchers::WithinRel((2 * M_PI + 126) / 4, AGGREGATE_TOLERANCE));
+    }
+
+    SECTION("Removing the extremes rescans them")
+    {
+        store.remove(3);
+        store.remove(2);
+
+        const FigureAggregates &aggregates = store.getAggregates();
+        REQUIRE_FALSE(aggregates.isStale());
+        REQUIRE(aggregates.minPerimeter() == 2 * M_PI);
+        REQUIRE(aggregates.maxPerimeter() == 60);
+        REQUIRE_THAT(aggregates.perimeterSum(), Catch::Matchers::WithinRel(72 + 2 * M_PI, AGGREGATE_TOLERANCE));
+
+        store.remove(4);
+        REQUIRE(aggregates.isStale());
+        REQUIRE(store.getAggregates().maxPerimeter() == 12);
+
+        store.remove(1);
+        store.remove(0);
+        REQUIRE(store.getAggregates().count() == 0);
+        REQUIRE(store.getAggregates().minPerimeter() == std::numeric_limits<double>::infinity());
+    }
+
+    SECTION("Clearing resets everything")
+    {
+        store.clear();
+
+        REQUIRE(store.getAggregates().count() == 0);
+        REQUIRE(store.getAggregates().perimeterSum() == 0);
+    }
+}
+
+TEST_CASE("Appending merges the aggregates of both stores", "[FigureAggregates]")
+{
+    FigureStore store;
+    store.add(Circle(2));
+    FigureStore other;
+    other.add(Triangle(1, 1, 1));
+    other.add(Rectangle(5, 5));
+    other.add(Rectangle(1, 1));
+
+    SECTION("Whole store")
+    {
+        store.append(other);
+
+        REQUIRE(store.getAggregates().count() == 4);
+        REQUIRE(store.getAggregates().minPerimeter() == 3);
+        REQUIRE(store.getAggregates().maxPerimeter() == 20);
+    }
+
+    SECTION("Store with a vacant slot")
+    {
+        other.remove(1);
+        store.append(other);
+
+        REQUIRE(store.getAggregates().count() == 3);
+        REQUIRE(store.getAggregates().maxPerimeter() == 4 * M_PI);
+    }
+
+    SECTION("Itself")
+    {
+        store.append(store);
+
+        REQUIRE(store.getAggregates().count(FigureUtil::CIRCLE) == 2);
+        REQUIRE_THAT(store.getAggregates().perimeterSum(), Catch::Matchers::WithinRel(8 * M_PI, AGGREGATE_TOLERANCE));
+    }
+}
+
+TEST_CASE("Perimeter sum is compensated", "[FigureAggregates]")
+{
+    FigureAggregates aggregates;
+    aggregates.add(FigureUtil::CIRCLE, 1e16);
+
+    double naive = 1e16;
+    for (int i = 0; i < 1000; i++)
+    {
+        aggregates.add(FigureUtil::CIRCLE, 1);
+        naive += 1;
+    }
+
+    REQUIRE(naive == 1e16);
+    REQUIRE(aggregates.perimeterSum() == 1e16 + 1000);
+
+    aggregates.remove(FigureUtil::CIRCLE, 1e16);
+    REQUIRE(aggregates.perimeterSum() == 1000);
+    REQUIRE(aggregates.count() == 1000);
+}
+
+TEST_CASE("Perimeter mean stays finite when the sum overflows", "[FigureAggregates]")
+{
+    FigureStore store;
+    store.add(Rectangle(4e307, 4e307));
+    store.add(Rectangle(4e307, 4e307));
+    store.add(Circle(1));
+
+    REQUIRE(store.getAggregates().perimeterSum() == std::numeric_limits<double>::infinity());
+    REQUIRE_THAT(store.getAggregates().meanPerimeter(),
+                 Catch::Matchers::WithinRel(1.6e308 / 3 * 2, AGGREGATE_TOLERANCE));
+
+    store.remove(0);
+    REQUIRE_THAT(store.getAggregates().perimeterSum(), Catch::Matchers::WithinRel(1.6e308, AGGREGATE_TOLERANCE));
+}
+
+TEST_CASE("Extremes stay exact as figures are cloned and removed", "[FigureAggregates]")
+{
+    FigureStore store;
+    for (int i = 1; i <= 200; i++)
+    {
+        store.add(Circle(i % 37 + 1));
+        store.add(Rectangle(i % 11 + 1, 2));
+    }
+
+    // The store keeps one aggregates object, so this reference shows whether a removal left it stale
+    const FigureAggregates &aggregates = store.getAggregates();
+    std::mt19937_64 rng(3);
+    for (int step = 0; step < 1000; step++)
+    {
+        const std::size_t number = std::uniform_int_distribution<std::size_t>(0, store.slotCount() - 1)(rng);
+        if (!store.contains(number))
+        {
+            continue;
+        }
+
+        if (step % 3 == 0)
+        {
+            store.clone(number);
+        }
+        else
+        {
+            // Only a removal of the current minimum or maximum leaves the extremes to rescan
+            const double perimeter = store.perimeterAt(number);
+            const bool extreme = perimeter <= store.getAggregates().minPerimeter() ||
+                                 perimeter >= store.getAggregates().maxPerimeter();
+            store.remove(number);
+            REQUIRE(aggregates.isStale() == extreme);
+        }
+
+        double min = std::numeric_limits<double>::infinity();
+        double max = -std::numeric_limits<double>::infinity();
+        for (std::size_t i = 0; i < store.slotCount(); i++)
+        {
+            if (store.contains(i))
+            {
+                min = std::min(min, store.perimeterAt(i));
+                max = std::max(max, store.perimeterAt(i));
+            }
+        }
+        REQUIRE(store.getAggregates().minPerimeter() == min);
+        REQUIRE(store.getAggregates().maxPerimeter() == max);
+    }
+
+    FigureStore other;
+    other.add(Circle(1000));
+    store.append(other);
+    REQUIRE_FALSE(store.getAggregates().isStale());
+    REQUIRE(store.getAggregates().maxPerimeter() == 2000 * M_PI);
+}
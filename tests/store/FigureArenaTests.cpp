@@ -0,0 +1,98 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <memory_resource>
+
+#include "../../src/figure/circle/Circle.hpp"
+#include "../../src/figure/rectangle/Rectangle.hpp"
+#include "../../src/figure/triangle/Triangle.hpp"
+#include "../../src/store/figure_arena/FigureArena.hpp"
+
+class CountingResource final : public std::pmr::memory_resource
+{
+  public:
+    std::size_t allocations = 0;
+    std::size_t deallocations = 0;
+
+  private:
+    void *do_allocate(const std::size_t bytes, const std::size_t alignment) override
+    {
+        allocations++;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void *p, const std::size_t bytes, const std::size_t alignment) override
+    {
+        deallocations++;
+        std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+};
+
+TEST_CASE("Figures cloned into a resource are independent copies", "[FigureArena]")
+{
+    std::pmr::unsynchronized_pool_resource pool;
+    const Triangle triangle(3, 4, 5);
+    const Circle circle(1.5);
+    const Rectangle rectangle(2, 3);
+
+    Figure *triangleCopy = triangle.clone(pool);
+    Circle *circleCopy = circle.clone(pool);
+    const Figure &base = rectangle;
+    Figure *rectangleCopy = base.clone(pool);
+
+    REQUIRE(triangleCopy != &triangle);
+    REQUIRE(triangleCopy->toString() == "Triangle 3 4 5");
+    REQUIRE(circleCopy->getRadius() == 1.5);
+    REQUIRE(rectangleCopy->getType() == FigureUtil::RECTANGLE);
+    REQUIRE(rectangleCopy->toString() == "Rectangle 2 3");
+}
+
+TEST_CASE("Arena creates and copies figures until released", "[FigureArena]")
+{
+    FigureArena arena;
+
+    const Circle *circle = arena.make<Circle>(2);
+    const Figure *copy = arena.copy(Triangle(3, 4, 5));
+
+    REQUIRE(arena.size() == 2);
+    REQUIRE(circle->toString() == "Circle 2");
+    REQUIRE(copy->toString() == "Triangle 3 4 5");
+
+    arena.release();
+    REQUIRE(arena.size() == 0);
+    REQUIRE(arena.make<Rectangle>(1, 2)->toString() == "Rectangle 1 2");
+}
+
+TEST_CASE("Arena frees a whole session with a few upstream calls", "[FigureArena]")
+{
+    CountingResource upstream;
+
+    {
+        FigureArena arena(&upstream);
+        for (int i = 1; i <= 10'000; i++)
+        {
+            arena.make<Circle>(i);
+        }
+
+        REQUIRE(upstream.allocations > 0);
+        REQUIRE(upstream.allocations < 20);
+
+        arena.release();
+        REQUIRE(upstream.deallocations == upstream.allocations);
+    }
+
+    REQUIRE(upstream.deallocations == upstream.allocations);
+}
+
+TEST_CASE("Arena rejects invalid figures without counting them", "[FigureArena]")
+{
+    FigureArena arena;
+
+    REQUIRE_THROWS_AS(arena.make<Circle>(-1), std::invalid_argument);
+    REQUIRE(arena.size() == 0);
+}
@@ -0,0 +1,98 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <random>
+#include <string>
+#include <unordered_set>
+
+#include "../../src/figure/circle/Circle.hpp"
+#include "../../src/figure/rectangle/Rectangle.hpp"
+#include "../../src/figure/triangle/Triangle.hpp"
+#include "../../src/store/figure_deduplicator/FigureDeduplicator.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+
+FigureStore makeDuplicatedStore()
+{
+    FigureStore store;
+    store.add(Circle(1));
+    store.add(Rectangle(2, 3));
+    store.add(Circle(1));
+    store.add(Triangle(3, 4, 5));
+    store.add(Rectangle(2, 3));
+    store.add(Circle(1));
+    store.add(Rectangle(3, 2));
+    return store;
+}
+
+TEST_CASE("Deduplicator counts figures that repeat an earlier one", "[FigureDeduplicator]")
+{
+    const FigureStore store = makeDuplicatedStore();
+
+    const FigureDeduplicator::Result result = FigureDeduplicator::count(store);
+
+    REQUIRE(result.figures == 7);
+    REQUIRE(result.distinct == 4);
+    REQUIRE(result.duplicates == 3);
+    REQUIRE(result.tableBytes > 0);
+    REQUIRE(store.size() == 7);
+}
+
+TEST_CASE("Deduplicator keeps the lowest-numbered figure of each group", "[FigureDeduplicator]")
+{
+    FigureStore store = makeDuplicatedStore();
+    store.remove(0);
+    store.clone(1);
+
+    const FigureDeduplicator::Result result = FigureDeduplicator::removeDuplicates(store);
+
+    REQUIRE(result.duplicates == 3);
+    REQUIRE(store.size() == 4);
+    REQUIRE(store.at(1)->toString() == "Rectangle 2 3");
+    REQUIRE(store.at(2)->toString() == "Circle 1");
+    REQUIRE(store.at(3)->toString() == "Triangle 3 4 5");
+    REQUIRE(store.at(6)->toString() == "Rectangle 3 2");
+    REQUIRE(FigureDeduplicator::count(store).duplicates == 0);
+}
+
+TEST_CASE("Parallel deduplication matches the single-threaded result", "[FigureDeduplicator]")
+{
+    std::mt19937_64 rng(9);
+    std::uniform_int_distribution<int> valueDist(1, 300);
+
+    FigureStore store;
+    for (int i = 0; i < 200'000; i++)
+    {
+        const double value = valueDist(rng);
+        switch (i % 3)
+        {
+        case 0:
+            store.add(Circle(value));
+            break;
+        case 1:
+            store.add(Rectangle(value, 2));
+            break;
+        default:
+            store.add(Triangle(value, value, value));
+        }
+    }
+
+    const FigureDeduplicator::Result single = FigureDeduplicator::count(store, 1);
+    REQUIRE(single.distinct == 900);
+    REQUIRE(single.duplicates == 200'000 - 900);
+
+    FigureStore parallel = store;
+    const FigureDeduplicator::Result result = FigureDeduplicator::removeDuplicates(parallel, 7);
+
+    REQUIRE(result.distinct == single.distinct);
+    REQUIRE(result.duplicates == single.duplicates);
+    REQUIRE(parallel.size() == 900);
+
+    std::unordered_set<std::string> seen;
+    std::size_t mismatches = 0;
+    for (std::size_t i = 0; i < store.slotCount(); i++)
+    {
+        mismatches += seen.insert(store.at(i)->toString()).second != parallel.contains(i);
+    }
+    REQUIRE(mismatches == 0);
+
+    REQUIRE_THROWS_AS(FigureDeduplicator::count(store, 0), std::invalid_argument);
+}
@@ -0,0 +1,109 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "../../src/factory/random_figure_factory/RandomFigureFactory.hpp"
+#include "../../src/figure/circle/Circle.hpp"
+#include "../../src/figure/rectangle/Rectangle.hpp"
+#include "../../src/figure/triangle/Triangle.hpp"
+#include "../../src/store/figure_sorter/FigureSorter.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+
+FigureStore makeSortableStore()
+{
+    FigureStore store;
+    store.add(Rectangle(10, 20));
+    store.add(Circle(1));
+    store.add(Triangle(3, 4, 5));
+    store.add(Rectangle(1, 1));
+    store.add(Circle(0.5));
+    store.add(Triangle(1, 1, 1));
+    return store;
+}
+
+TEST_CASE("Sort keys are parsed by name", "[FigureSorter]")
+{
+    REQUIRE(FigureSorter::parseKey("type") == FigureSorter::TYPE);
+    REQUIRE(FigureSorter::parseKey("perimeter") == FigureSorter::PERIMETER);
+    REQUIRE(FigureSorter::parseKey("height") == FigureSorter::HEIGHT);
+    REQUIRE_THROWS_WITH(FigureSorter::parseKey("area"), "Unknown sort key: 'area'");
+}
+
+TEST_CASE("Sorting orders by the key and keeps ties in number order", "[FigureSorter]")
+{
+    const FigureStore store = makeSortableStore();
+
+    for (const FigureSorter::Algorithm algorithm : {FigureSorter::RADIX, FigureSorter::MERGE})
+    {
+        REQUIRE(FigureSorter::order(store, FigureSorter::TYPE, false, 1, algorithm) ==
+                std::vector<std::uint32_t>{2, 5, 1, 4, 0, 3});
+        REQUIRE(FigureSorter::order(store, FigureSorter::TYPE, true, 1, algorithm) ==
+                std::vector<std::uint32_t>{0, 3, 1, 4, 2, 5});
+        REQUIRE(FigureSorter::order(store, FigureSorter::PERIMETER, false, 1, algorithm) ==
+                std::vector<std::uint32_t>{5, 4, 3, 1, 2, 0});
+        REQUIRE(FigureSorter::order(store, FigureSorter::PERIMETER, true, 1, algorithm) ==
+                std::vector<std::uint32_t>{0, 2, 1, 3, 4, 5});
+        REQUIRE(FigureSorter::order(store, FigureSorter::RADIUS, false, 1, algorithm) ==
+                std::vector<std::uint32_t>{4, 1, 0, 2, 3, 5});
+        REQUIRE(FigureSorter::order(store, FigureSorter::WIDTH, true, 1, algorithm) ==
+                std::vector<std::uint32_t>{0, 3, 1, 2, 4, 5});
+    }
+}
+
+TEST_CASE("Sorting renumbers the store", "[FigureSorter]")
+{
+    FigureStore store = makeSortableStore();
+    store.remove(0);
+    const FigureStore::Handle handle = store.handleAt(1);
+
+    FigureSorter::sort(store, FigureSorter::PERIMETER);
+
+    REQUIRE(store.size() == 5);
+    REQUIRE(store.slotCount() == 5);
+    REQUIRE_FALSE(store.contains(handle));
+    REQUIRE(store.at(0)->toString() == "Triangle 1 1 1");
+    REQUIRE(store.at(1)->toString() == "Circle 0.5");
+    REQUIRE(store.at(4)->toString() == "Triangle 3 4 5");
+    REQUIRE(store.getAggregates().count(FigureUtil::CIRCLE) == 2);
+
+    store.remove(1);
+    REQUIRE(store.getCircleRadius().size() == 1);
+    REQUIRE(store.at(3)->toString() == "Circle 1");
+}
+
+TEST_CASE("Parallel sorts match the single-threaded sort", "[FigureSorter]")
+{
+    FigureStore store;
+    RandomFigureFactory(13).createBatch(200'000, store);
+    for (std::size_t i = 0; i < store.slotCount(); i += 7)
+    {
+        store.remove(i);
+    }
+
+    for (const FigureSorter::Key key : {FigureSorter::TYPE, FigureSorter::PERIMETER, FigureSorter::SIDE_B})
+    {
+        const std::vector<std::uint32_t> expected = FigureSorter::order(store, key, false, 1, FigureSorter::MERGE);
+
+        REQUIRE(expected.size() == store.size());
+        REQUIRE(FigureSorter::order(store, key, false, 1, FigureSorter::RADIX) == expected);
+        REQUIRE(FigureSorter::order(store, key, false, 5, FigureSorter::RADIX) == expected);
+        REQUIRE(FigureSorter::order(store, key, false, 3, FigureSorter::MERGE) == expected);
+    }
+
+    const std::vector<std::uint32_t> order = FigureSorter::order(store, FigureSorter::PERIMETER, false, 4);
+    REQUIRE(std::ranges::is_sorted(order, {}, [&](const std::uint32_t number) { return store.perimeterAt(number); }));
+}
+
+TEST_CASE("Reordering rejects an incomplete order", "[FigureSorter]")
+{
+    FigureStore store = makeSortableStore();
+
+    REQUIRE_THROWS_WITH(store.reorder(std::vector<std::uint32_t>{0, 1, 2}),
+                        "Order must name every figure exactly once");
+    REQUIRE_THROWS_WITH(store.reorder(std::vector<std::uint32_t>{0, 1, 2, 3, 4, 4}),
+                        "Order must name every figure exactly once");
+    REQUIRE(store.at(0)->toString() == "Rectangle 10 20");
+    REQUIRE_THROWS_AS(FigureSorter::order(store, FigureSorter::TYPE, false, 0), std::invalid_argument);
+}
@@ -0,0 +1,369 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <array>
+#include <cmath>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+#include "../../src/figure/circle/Circle.hpp"
+#include "../../src/figure/plugin_figure/PluginFigure.hpp"
+#include "../../src/figure/rectangle/Rectangle.hpp"
+#include "../../src/figure/triangle/Triangle.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../../src/util/binary_figure_format/BinaryFigureFormat.hpp"
+
+constexpr double TOLERANCE = 1e-10;
+
+FigureStore makeMixedStore()
+{
+    FigureStore store;
+    store.add(Circle(5));
+    store.add(Rectangle(10, 20));
+    store.add(Triangle(3, 4, 5));
+    store.add(Circle(7.5));
+    return store;
+}
+
+TEST_CASE("Empty store has no figures", "[FigureStore]")
+{
+    const FigureStore store;
+
+    REQUIRE(store.empty());
+    REQUIRE(store.size() == 0);
+    REQUIRE_THROWS_AS(store.at(0), std::out_of_range);
+}
+
+TEST_CASE("Store keeps figures in insertion order", "[FigureStore]")
+{
+    const FigureStore store = makeMixedStore();
+
+    REQUIRE(store.size() == 4);
+    REQUIRE(store.typeAt(0) == FigureUtil::CIRCLE);
+    REQUIRE(store.typeAt(1) == FigureUtil::RECTANGLE);
+    REQUIRE(store.typeAt(2) == FigureUtil::TRIANGLE);
+    REQUIRE(store.typeAt(3) == FigureUtil::CIRCLE);
+
+    REQUIRE(store.at(0)->toString() == "Circle 5");
+    REQUIRE(store.at(1)->toString() == "Rectangle 10 20");
+    REQUIRE(store.at(2)->toString() == "Triangle 3 4 5");
+    REQUIRE(store.at(3)->toString() == "Circle 7.5");
+}
+
+TEST_CASE("Store accepts polymorphic figures", "[FigureStore]")
+{
+    FigureStore store;
+    const std::unique_ptr<Figure> figure = std::make_unique<Triangle>(5, 5, 5);
+
+    store.add(*figure);
+
+    REQUIRE(store.size() == 1);
+    REQUIRE_THAT(store.at(0)->perimeter(), Catch::Matchers::WithinRel(15.0, TOLERANCE));
+}
+
+TEST_CASE("Clone appends a copy to the end", "[FigureStore]")
+{
+    FigureStore store = makeMixedStore();
+
+    store.clone(2);
+
+    REQUIRE(store.size() == 5);
+    REQUIRE(store.at(4)->toString() == "Triangle 3 4 5");
+    REQUIRE(store.at(2)->toString() == "Triangle 3 4 5");
+    REQUIRE_THROWS_AS(store.clone(5), std::out_of_range);
+}
+
+TEST_CASE("Remove leaves the other figures at their numbers", "[FigureStore]")
+{
+    FigureStore store = makeMixedStore();
+
+    SECTION("Remove from the front")
+    {
+        store.remove(0);
+
+        REQUIRE(store.size() == 3);
+        REQUIRE(store.slotCount() == 4);
+        REQUIRE_FALSE(store.contains(0));
+        REQUIRE_THROWS_AS(store.at(0), std::out_of_range);
+        REQUIRE(store.at(1)->toString() == "Rectangle 10 20");
+        REQUIRE(store.at(2)->toString() == "Triangle 3 4 5");
+        REQUIRE(store.at(3)->toString() == "Circle 7.5");
+    }
+
+    SECTION("Remove from the back")
+    {
+        store.remove(3);
+
+        REQUIRE(store.size() == 3);
+        REQUIRE(store.at(0)->toString() == "Circle 5");
+    }
+
+    SECTION("Remove out of range")
+    {
+        REQUIRE_THROWS_AS(store.remove(4), std::out_of_range);
+        REQUIRE(store.size() == 4);
+    }
+
+    SECTION("Remove twice")
+    {
+        store.remove(1);
+
+        REQUIRE_THROWS_WITH(store.remove(1), "No figure at index 1");
+        REQUIRE(store.size() == 3);
+    }
+
+    SECTION("Remove everything")
+    {
+        for (std::size_t i = 0; i < store.slotCount(); i++)
+        {
+            store.remove(i);
+        }
+
+        REQUIRE(store.empty());
+        REQUIRE(store.getCircleRadius().empty());
+    }
+}
+
+TEST_CASE("Remove keeps the columns dense and consistent", "[FigureStore]")
+{
+    FigureStore store;
+    for (int i = 1; i <= 6; i++)
+    {
+        store.add(Circle(i));
+    }
+
+    store.remove(1);
+    store.remove(3);
+
+    REQUIRE(store.getCircleRadius().size() == 4);
+    REQUIRE(store.at(0)->toString() == "Circle 1");
+    REQUIRE(store.at(2)->toString() == "Circle 3");
+    REQUIRE(store.at(4)->toString() == "Circle 5");
+    REQUIRE(store.at(5)->toString() == "Circle 6");
+
+    store.clone(5);
+    REQUIRE(store.at(6)->toString() == "Circle 6");
+}
+
+TEST_CASE("Handles go stale when their figure is removed or moved", "[FigureStore]")
+{
+    FigureStore store = makeMixedStore();
+    const FigureStore::Handle first = store.handleAt(0);
+    const FigureStore::Handle third = store.handleAt(2);
+    const FigureStore::Handle last = store.handleAt(3);
+
+    store.remove(1);
+    REQUIRE(store.contains(first));
+    REQUIRE(store.indexOf(third) == 2);
+
+    store.compact();
+
+    REQUIRE(store.slotCount() == 3);
+    REQUIRE(store.contains(first));
+    REQUIRE_FALSE(store.contains(third));
+    REQUIRE_FALSE(store.contains(last));
+    REQUIRE_THROWS_WITH(store.indexOf(third), "Stale figure handle");
+    REQUIRE(store.at(1)->toString() == "Triangle 3 4 5");
+    REQUIRE(store.at(2)->toString() == "Circle 7.5");
+
+    store.remove(2);
+    store.compact();
+    const FigureStore::Handle copy = store.clone(1);
+    REQUIRE(store.indexOf(copy) == 2);
+    REQUIRE(store.at(2)->toString() == "Triangle 3 4 5");
+}
+
+TEST_CASE("Appending a store with vacant slots copies only its figures", "[FigureStore]")
+{
+    FigureStore other = makeMixedStore();
+    other.remove(0);
+    other.remove(2);
+
+    FigureStore store;
+    store.append(other);
+
+    REQUIRE(store.size() == 2);
+    REQUIRE(store.slotCount() == 2);
+    REQUIRE(store.at(0)->toString() == "Rectangle 10 20");
+    REQUIRE(store.at(1)->toString() == "Circle 7.5");
+}
+
+TEST_CASE("Memory report favours the columnar layout", "[FigureStore]")
+{
+    FigureStore store;
+    for (int i = 1; i <= 1000; i++)
+    {
+        store.add(Circle(i));
+        store.add(Rectangle(i, i));
+        store.add(Triangle(i, i, i));
+    }
+
+    const FigureStore::MemoryReport report = store.memoryReport();
+
+    REQUIRE(report.figureCount == 3000);
+    REQUIRE(report.storeBytes > 0);
+    REQUIRE(report.storeBytes < report.pointerLayoutBytes);
+}
+
+TEST_CASE("Append copies figures from another store in order", "[FigureStore]")
+{
+    FigureStore store;
+    store.add(Rectangle(1, 2));
+    const FigureStore other = makeMixedStore();
+
+    SECTION("Whole store")
+    {
+        store.append(other);
+
+        REQUIRE(store.size() == 5);
+        REQUIRE(store.at(0)->toString() == "Rectangle 1 2");
+        REQUIRE(store.at(2)->toString() == "Rectangle 10 20");
+        REQUIRE(store.at(4)->toString() == "Circle 7.5");
+    }
+
+    SECTION("Range")
+    {
+        store.append(other, 1, 2);
+
+        REQUIRE(store.size() == 3);
+        REQUIRE(store.at(1)->toString() == "Rectangle 10 20");
+        REQUIRE(store.at(2)->toString() == "Triangle 3 4 5");
+    }
+
+    SECTION("Range out of bounds")
+    {
+        REQUIRE_THROWS_AS(store.append(other, 3, 2), std::out_of_range);
+    }
+}
+
+TEST_CASE("Store formats figures without materialising them", "[FigureStore]")
+{
+    const FigureStore store = makeMixedStore();
+
+    std::string out;
+    for (std::size_t i = 0; i < store.size(); i++)
+    {
+        store.formatTo(i, out);
+        out += ';';
+    }
+
+    REQUIRE(out == "Circle 5;Rectangle 10 20;Triangle 3 4 5;Circle 7.5;");
+    REQUIRE_THROWS_AS(store.formatTo(4, out), std::out_of_range);
+}
+
+const PluginRegistry &storePluginShapes()
+{
+    static const PluginRegistry registry = [] {
+        PluginRegistry loaded;
+        loaded.loadDirectory(FIGURES_PLUGIN_DIR);
+        return loaded;
+    }();
+    return registry;
+}
+
+FigureStore makeStoreWithPlugins()
+{
+    const PluginRegistry &registry = storePluginShapes();
+
+    FigureStore store;
+    store.add(Circle(1));
+    store.add(PluginFigure(registry, *registry.find("polygon"), std::array{6.0, 2.0}));
+    store.add(Rectangle(2, 3));
+    store.add(PluginFigure(registry, *registry.find("trapezoid"), std::array{10.0, 4.0, 5.0, 5.5}));
+    return store;
+}
+
+TEST_CASE("Store keeps plugin figures beside the built-in ones", "[FigureStore]")
+{
+    FigureStore store = makeStoreWithPlugins();
+
+    REQUIRE(store.size() == 4);
+    REQUIRE(store.getPluginFigures().size() == 2);
+    REQUIRE(store.getEntries()[1].type == FigureStore::PLUGIN);
+    REQUIRE(store.at(1)->toString() == "Polygon 6 2");
+    REQUIRE(store.perimeterAt(3) == 24.5);
+    REQUIRE_THROWS_AS(store.typeAt(1), std::logic_error);
+    REQUIRE(store.getAggregates().count() == 4);
+    REQUIRE(store.getAggregates().pluginCount() == 2);
+
+    const FigureStore::Handle clone = store.clone(1);
+    REQUIRE(store.equalAt(1, store.indexOf(clone)));
+    REQUIRE(store.hashAt(1) == store.hashAt(store.indexOf(clone)));
+    REQUIRE_FALSE(store.equalAt(1, 3));
+
+    // Removing the polygon moves the last plugin figure, the clone, into its row
+    store.remove(1);
+    store.compact();
+    REQUIRE(store.size() == 4);
+    REQUIRE(store.at(3)->toString() == "Polygon 6 2");
+    REQUIRE(store.getAggregates().pluginCount() == 2);
+    REQUIRE(store.getAggregates().minPerimeter() == store.perimeterAt(0));
+
+    store.reorder(std::array<std::uint32_t, 4>{3, 2, 1, 0});
+    std::string out;
+    for (std::size_t i = 0; i < store.size(); i++)
+    {
+        store.formatTo(i, out);
+        out += ';';
+    }
+    REQUIRE(out == "Polygon 6 2;Trapezoid 10 4 5 5.5;Rectangle 2 3;Circle 1;");
+}
+
+TEST_CASE("Store appends plugin figures from another store", "[FigureStore]")
+{
+    const FigureStore other = makeStoreWithPlugins();
+
+    FigureStore whole;
+    whole.add(PluginFigure(storePluginShapes(), *storePluginShapes().find("ellipse"), std::array{1.0, 1.0}));
+    whole.append(other);
+    REQUIRE(whole.size() == 5);
+    REQUIRE(whole.at(4)->toString() == "Trapezoid 10 4 5 5.5");
+    REQUIRE(whole.getAggregates().pluginCount() == 3);
+
+    FigureStore range;
+    range.append(other, 1, 2);
+    REQUIRE(range.size() == 2);
+    REQUIRE(range.at(0)->toString() == "Polygon 6 2");
+    REQUIRE(range.getAggregates().pluginCount() == 1);
+}
+
+TEST_CASE("Store rescans plugin perimeters through the plugin kernels", "[FigureStore]")
+{
+    FigureStore store = makeStoreWithPlugins();
+    for (int i = 0; i < 5000; i++)
+    {
+        store.add(PluginFigure(storePluginShapes(), *storePluginShapes().find("polygon"), std::array{4.0, 1.0}));
+    }
+
+    // Removing a figure that holds the minimum leaves the extremes stale, so the next read rescans every column
+    store.remove(4);
+    const FigureAggregates &aggregates = store.getAggregates();
+    REQUIRE(aggregates.pluginCount() == 5001);
+    REQUIRE(aggregates.minPerimeter() == 4);
+    REQUIRE(aggregates.maxPerimeter() == 24.5);
+    REQUIRE_THAT(aggregates.perimeterSum(),
+                 Catch::Matchers::WithinAbs(2 * M_PI + 12 + 10 + 24.5 + 4999 * 4, TOLERANCE));
+}
+
+TEST_CASE("Binary format saves plugin figures by type name", "[FigureStore]")
+{
+    std::ostringstream output;
+    BinaryFigureFormat::write(output, makeStoreWithPlugins());
+    const std::string data = output.str();
+
+    const BinaryFigureFormat::Header header = BinaryFigureFormat::readHeader(data);
+    REQUIRE(header.version == BinaryFigureFormat::PLUGIN_VERSION);
+    REQUIRE(header.figureCount == 4);
+    REQUIRE(BinaryFigureFormat::pluginCount(header) == 2);
+
+    const BinaryFigureFormat::PluginTable table = BinaryFigureFormat::readPluginTable(data, header);
+    REQUIRE(table.types.size() == 2);
+    REQUIRE(table.types[0].name == "polygon");
+    REQUIRE(table.types[1].params == 4);
+
+    REQUIRE_THROWS_WITH(BinaryFigureFormat::readHeader(data.substr(0, data.size() - 1)),
+                        "Binary figure file is truncated or corrupt");
+}
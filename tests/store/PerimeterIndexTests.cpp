@@ -0,0 +1,156 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "../../src/figure/circle/Circle.hpp"
+#include "../../src/figure/rectangle/Rectangle.hpp"
+#include "../../src/figure/triangle/Triangle.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../../src/store/perimeter_index/PerimeterIndex.hpp"
+
+// Rectangles of growing perimeter, every third one repeating the perimeter of the one before it
+FigureStore makeIndexedStore(const int count)
+{
+    FigureStore store;
+    for (int i = 0; i < count; i++)
+    {
+        const double side = i % 3 == 2 ? i : i + 1;
+        store.add(Rectangle(side, 1));
+    }
+    return store;
+}
+
+std::vector<PerimeterIndex::Key> keysInRange(const PerimeterIndex &index, const double minPerimeter,
+                                             const double maxPerimeter)
+{
+    std::vector<PerimeterIndex::Key> keys;
+    index.forEachInRange(minPerimeter, maxPerimeter, [&](const PerimeterIndex::Key key) { keys.push_back(key); });
+    return keys;
+}
+
+TEST_CASE("Empty perimeter index", "[PerimeterIndex]")
+{
+    PerimeterIndex index;
+    index.build(FigureStore());
+
+    REQUIRE(index.empty());
+    REQUIRE(index.countInRange(0, 100) == 0);
+    REQUIRE(keysInRange(index, 0, 100).empty());
+    REQUIRE_THROWS_WITH(index.kth(0), "No figure at rank 0");
+}
+
+TEST_CASE("Perimeter index orders figures by perimeter then number", "[PerimeterIndex]")
+{
+    FigureStore store;
+    store.add(Circle(10));
+    store.add(Triangle(1, 1, 1));
+    store.add(Rectangle(2, 3));
+    store.add(Triangle(3, 3, 4));
+
+    PerimeterIndex index;
+    index.build(store);
+
+    REQUIRE(index.size() == 4);
+    REQUIRE(index.kth(0).number == 1);
+    REQUIRE(index.kth(1).number == 2);
+    REQUIRE(index.kth(1).perimeter == 10);
+    REQUIRE(index.kth(2).number == 3);
+    REQUIRE(index.kth(3).number == 0);
+
+    REQUIRE(index.countBelow(10) == 1);
+    REQUIRE(index.countAtMost(10) == 3);
+    REQUIRE(index.countInRange(10, 10) == 2);
+    REQUIRE(index.countInRange(11, 10) == 0);
+
+    const std::vector<PerimeterIndex::Key> keys = keysInRange(index, 5, 10);
+    REQUIRE(keys.size() == 2);
+    REQUIRE(keys[0].number == 2);
+    REQUIRE(keys[1].number == 3);
+}
+
+TEST_CASE("Perimeter index follows clones and removals", "[PerimeterIndex]")
+{
+    FigureStore store = makeIndexedStore(200);
+    PerimeterIndex index;
+    index.build(store);
+
+    std::mt19937 rng(5);
+    for (int step = 0; step < 500; step++)
+    {
+        std::uniform_int_distribution<std::size_t> slotDist(0, store.slotCount() - 1);
+        const std::size_t number = slotDist(rng);
+        if (!store.contains(number))
+        {
+            continue;
+        }
+
+        if (step % 2 == 0)
+        {
+            const FigureStore::Handle copy = store.clone(number);
+            index.insert(store.perimeterAt(copy.slot), copy.slot);
+        }
+        else
+        {
+            REQUIRE(index.erase(store.perimeterAt(number), number));
+            store.remove(number);
+        }
+    }
+
+    REQUIRE_FALSE(index.erase(-1, 0));
+    REQUIRE(index.size() == store.size());
+
+    PerimeterIndex rebuilt;
+    rebuilt.build(store);
+
+    std::vector<std::size_t> scanned;
+    for (std::size_t i = 0; i < store.slotCount(); i++)
+    {
+        if (store.contains(i))
+        {
+            scanned.push_back(i);
+        }
+    }
+    std::ranges::sort(scanned, [&](const std::size_t a, const std::size_t b) {
+        return store.perimeterAt(a) < store.perimeterAt(b) ||
+               (store.perimeterAt(a) == store.perimeterAt(b) && a < b);
+    });
+
+    for (std::size_t k = 0; k < scanned.size(); k++)
+    {
+        REQUIRE(index.kth(k).number == scanned[k]);
+        REQUIRE(rebuilt.kth(k).number == scanned[k]);
+    }
+
+    for (const double minPerimeter : {0.0, 50.0, 101.0, 400.0})
+    {
+        const double maxPerimeter = minPerimeter + 120;
+        const std::size_t expected = std::ranges::count_if(scanned, [&](const std::size_t number) {
+            return store.perimeterAt(number) >= minPerimeter && store.perimeterAt(number) <= maxPerimeter;
+        });
+
+        REQUIRE(index.countInRange(minPerimeter, maxPerimeter) == expected);
+
+        const std::vector<PerimeterIndex::Key> keys = keysInRange(index, minPerimeter, maxPerimeter);
+        REQUIRE(keys.size() == expected);
+        REQUIRE(std::ranges::is_sorted(keys, {}, &PerimeterIndex::Key::perimeter));
+    }
+}
+
+TEST_CASE("Perimeter index erases only the matching figure", "[PerimeterIndex]")
+{
+    const FigureStore store = makeIndexedStore(6);
+    PerimeterIndex index;
+    index.build(store);
+
+    REQUIRE(index.countInRange(6, 6) == 2);
+    REQUIRE_FALSE(index.erase(6, 5));
+    REQUIRE(index.erase(6, 2));
+    REQUIRE(index.countInRange(6, 6) == 1);
+    REQUIRE(index.kth(1).number == 1);
+
+    index.insert(6, 2);
+    REQUIRE(index.kth(2).number == 2);
+}
@@ -0,0 +1,76 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <sstream>
+#include <string>
+
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../../src/util/binary_figure_format/BinaryFigureFormat.hpp"
+
+std::string writeBinary(const FigureStore &store)
+{
+    std::ostringstream output;
+    BinaryFigureFormat::write(output, store);
+    return output.str();
+}
+
+TEST_CASE("Binary header records the figure count per type", "[BinaryFigureFormat]")
+{
+    FigureStore store;
+    store.add(Circle(5));
+    store.add(Rectangle(10, 20));
+    store.add(Circle(7));
+
+    const std::string data = writeBinary(store);
+    const BinaryFigureFormat::Header header = BinaryFigureFormat::readHeader(data);
+
+    REQUIRE(data.substr(0, 4) == "FIGB");
+    REQUIRE(header.figureCount == 3);
+    REQUIRE(header.typeCounts[FigureUtil::TRIANGLE] == 0);
+    REQUIRE(header.typeCounts[FigureUtil::CIRCLE] == 2);
+    REQUIRE(header.typeCounts[FigureUtil::RECTANGLE] == 1);
+    REQUIRE(data.size() == BinaryFigureFormat::HEADER_SIZE + 3 + 4 * sizeof(double));
+}
+
+TEST_CASE("Binary values are little-endian doubles", "[BinaryFigureFormat]")
+{
+    FigureStore store;
+    store.add(Circle(0.1));
+
+    const std::string data = writeBinary(store);
+    const BinaryFigureFormat::Header header = BinaryFigureFormat::readHeader(data);
+    const std::size_t offset = BinaryFigureFormat::columnOffset(header, FigureUtil::CIRCLE, 0);
+
+    REQUIRE(static_cast<unsigned char>(data[offset]) == 0x9a);
+    REQUIRE(static_cast<unsigned char>(data[offset + 7]) == 0x3f);
+    REQUIRE(BinaryFigureFormat::readDouble(data.data() + offset) == 0.1);
+}
+
+TEST_CASE("Binary header rejects foreign, newer and damaged files", "[BinaryFigureFormat]")
+{
+    FigureStore store;
+    store.add(Triangle(3, 4, 5));
+    std::string data = writeBinary(store);
+
+    SECTION("Text file")
+    {
+        REQUIRE_THROWS_WITH(BinaryFigureFormat::readHeader("circle 5\n"), "Not a binary figure file");
+    }
+
+    SECTION("Unknown version")
+    {
+        data[4] = 3;
+        REQUIRE_THROWS_WITH(BinaryFigureFormat::readHeader(data), "Unsupported binary figure file version: 3");
+    }
+
+    SECTION("Truncated")
+    {
+        data.pop_back();
+        REQUIRE_THROWS_WITH(BinaryFigureFormat::readHeader(data), "Binary figure file is truncated or corrupt");
+    }
+
+    SECTION("Type table disagrees with the figures")
+    {
+        data[BinaryFigureFormat::HEADER_SIZE] = FigureUtil::CIRCLE;
+        REQUIRE_THROWS_WITH(BinaryFigureFormat::readHeader(data), "Binary figure file is truncated or corrupt");
+    }
+}
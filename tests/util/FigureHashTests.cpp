@@ -0,0 +1,46 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include <array>
+
+#include "../../src/figure/circle/Circle.hpp"
+#include "../../src/figure/rectangle/Rectangle.hpp"
+#include "../../src/figure/triangle/Triangle.hpp"
+#include "../../src/store/figure_store/FigureStore.hpp"
+#include "../../src/util/figure_hash/FigureHash.hpp"
+
+TEST_CASE("Figure hash depends on the type and every parameter", "[FigureHash]")
+{
+    REQUIRE(FigureHash::hash(Circle(1)) == FigureHash::hash(Circle(1)));
+    REQUIRE(FigureHash::hash(Circle(1)) != FigureHash::hash(Circle(2)));
+    REQUIRE(FigureHash::hash(Rectangle(2, 3)) != FigureHash::hash(Rectangle(3, 2)));
+    REQUIRE(FigureHash::hash(Triangle(3, 4, 5)) != FigureHash::hash(Triangle(3, 5, 4)));
+    REQUIRE(FigureHash::hash(FigureUtil::CIRCLE, std::array{1.0}) !=
+            FigureHash::hash(FigureUtil::TRIANGLE, std::array{1.0}));
+}
+
+TEST_CASE("Figure hash treats signed zeros alike", "[FigureHash]")
+{
+    REQUIRE(FigureHash::hash(FigureUtil::RECTANGLE, std::array{-0.0, 1.0}) ==
+            FigureHash::hash(FigureUtil::RECTANGLE, std::array{0.0, 1.0}));
+}
+
+TEST_CASE("Figure hash is stable across runs", "[FigureHash]")
+{
+    REQUIRE(FigureHash::hash(Circle(1)) == 0x7D5872C1BE968F7EULL);
+}
+
+TEST_CASE("Store hashes and compares figures by content", "[FigureHash]")
+{
+    FigureStore store;
+    store.add(Rectangle(2, 3));
+    store.add(Circle(1));
+    store.add(Rectangle(2, 3));
+    store.add(Rectangle(2, 4));
+
+    REQUIRE(store.hashAt(0) == FigureHash::hash(Rectangle(2, 3)));
+    REQUIRE(store.hashAt(0) == store.hashAt(2));
+    REQUIRE(store.equalAt(0, 2));
+    REQUIRE_FALSE(store.equalAt(0, 3));
+    REQUIRE_FALSE(store.equalAt(0, 1));
+    REQUIRE_THROWS_AS(store.hashAt(4), std::out_of_range);
+}
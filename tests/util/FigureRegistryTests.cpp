@@ -0,0 +1,60 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <array>
+#include <optional>
+#include <string>
+#include <string_view>
+
+#include "../../src/util/figure_registry/FigureRegistry.hpp"
+
+static_assert(FigureRegistry::find("circle") == FigureUtil::CIRCLE);
+static_assert(FigureRegistry::params(FigureUtil::TRIANGLE) == 3);
+
+TEST_CASE("Registry finds figure names ignoring case", "[FigureRegistry]")
+{
+    REQUIRE(FigureRegistry::find("triangle") == FigureUtil::TRIANGLE);
+    REQUIRE(FigureRegistry::find("Circle") == FigureUtil::CIRCLE);
+    REQUIRE(FigureRegistry::find("RECTANGLE") == FigureUtil::RECTANGLE);
+}
+
+TEST_CASE("Registry rejects names that only share a hash", "[FigureRegistry]")
+{
+    const std::string_view name = GENERATE("", "t", "trixngle", "circlE ", "rectangles", "square", "c", "ce");
+
+    REQUIRE_FALSE(FigureRegistry::find(name).has_value());
+}
+
+TEST_CASE("Registry knows the name and parameter count of each type", "[FigureRegistry]")
+{
+    REQUIRE(FigureRegistry::name(FigureUtil::TRIANGLE) == "triangle");
+    REQUIRE(FigureRegistry::name(FigureUtil::CIRCLE) == "circle");
+    REQUIRE(FigureRegistry::name(FigureUtil::RECTANGLE) == "rectangle");
+    REQUIRE(FigureRegistry::displayName(FigureUtil::TRIANGLE) == "Triangle");
+    REQUIRE(FigureRegistry::displayName(FigureUtil::RECTANGLE) == "Rectangle");
+    REQUIRE(FigureRegistry::params(FigureUtil::CIRCLE) == 1);
+    REQUIRE(FigureRegistry::params(FigureUtil::RECTANGLE) == 2);
+}
+
+TEST_CASE("Registry dispatches a type to its figure class", "[FigureRegistry]")
+{
+    constexpr std::array params{3.0, 4.0, 5.0};
+
+    const auto describe = [&params](const FigureUtil::FigureType type) {
+        return FigureRegistry::visit(type, [&params]<typename T>() {
+            return FigureRegistry::make<T>(std::span(params).first(T::PARAMS)).toString();
+        });
+    };
+
+    REQUIRE(describe(FigureUtil::TRIANGLE) == "Triangle 3 4 5");
+    REQUIRE(describe(FigureUtil::CIRCLE) == "Circle 3");
+    REQUIRE(describe(FigureUtil::RECTANGLE) == "Rectangle 3 4");
+}
+
+TEST_CASE("Registry tryMake reports invalid parameters", "[FigureRegistry]")
+{
+    constexpr std::array params{1.0, 2.0, 10.0};
+
+    REQUIRE(FigureRegistry::tryMake<Triangle>(params).error() == ParseError::INVALID_TRIANGLE);
+    REQUIRE(FigureRegistry::tryMake<Rectangle>(std::span(params).first(2)).has_value());
+}
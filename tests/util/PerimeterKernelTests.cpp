@@ -0,0 +1,119 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+
+#include <random>
+#include <vector>
+
+#include "../../src/figure/circle/Circle.hpp"
+#include "../../src/figure/rectangle/Rectangle.hpp"
+#include "../../src/figure/triangle/Triangle.hpp"
+#include "../../src/util/perimeter_kernel/PerimeterKernel.hpp"
+
+constexpr std::size_t COLUMN_SIZE = 1027;
+
+std::vector<double> randomColumn(std::mt19937_64 &rng, const double minValue, const double maxValue)
+{
+    std::uniform_real_distribution dist(minValue, maxValue);
+    std::vector<double> column(COLUMN_SIZE);
+    for (double &value : column)
+    {
+        value = dist(rng);
+    }
+    return column;
+}
+
+TEST_CASE("Scalar kernel is always supported", "[PerimeterKernel]")
+{
+    REQUIRE(PerimeterKernel::isSupported(PerimeterKernel::SCALAR));
+    REQUIRE(PerimeterKernel::isSupported(PerimeterKernel::detectIsa()));
+}
+
+TEST_CASE("Kernels match Figure::perimeter bit for bit", "[PerimeterKernel]")
+{
+    const PerimeterKernel::Isa isa =
+        GENERATE(PerimeterKernel::SCALAR, PerimeterKernel::SSE2, PerimeterKernel::AVX2);
+
+    if (!PerimeterKernel::isSupported(isa))
+    {
+        SKIP("Instruction set not supported by this CPU");
+    }
+
+    CAPTURE(isa);
+
+    std::mt19937_64 rng(42);
+    std::vector<double> out(COLUMN_SIZE);
+
+    SECTION("Triangles")
+    {
+        const std::vector<double> a = randomColumn(rng, 1, 1e6);
+        const std::vector<double> b = a;
+        const std::vector<double> c = randomColumn(rng, 1e-3, 1);
+
+        const std::span<double> result = PerimeterKernel::triangles(isa, a, b, c, out);
+
+        REQUIRE(result.size() == COLUMN_SIZE);
+        for (std::size_t i = 0; i < COLUMN_SIZE; i++)
+        {
+            REQUIRE(result[i] == Triangle(a[i], b[i], c[i]).perimeter());
+        }
+    }
+
+    SECTION("Circles")
+    {
+        const std::vector<double> radius = randomColumn(rng, 1e-300, 1e300);
+
+        const std::span<double> result = PerimeterKernel::circles(isa, radius, out);
+
+        REQUIRE(result.size() == COLUMN_SIZE);
+        for (std::size_t i = 0; i < COLUMN_SIZE; i++)
+        {
+            REQUIRE(result[i] == Circle(radius[i]).perimeter());
+        }
+    }
+
+    SECTION("Rectangles")
+    {
+        const std::vector<double> width = randomColumn(rng, 1e-300, 1e300);
+        const std::vector<double> height = randomColumn(rng, 1e-10, 1e10);
+
+        const std::span<double> result = PerimeterKernel::rectangles(isa, width, height, out);
+
+        REQUIRE(result.size() == COLUMN_SIZE);
+        for (std::size_t i = 0; i < COLUMN_SIZE; i++)
+        {
+            REQUIRE(result[i] == Rectangle(width[i], height[i]).perimeter());
+        }
+    }
+}
+
+TEST_CASE("Kernels handle empty columns", "[PerimeterKernel]")
+{
+    const std::vector<double> empty;
+    std::vector<double> out;
+
+    REQUIRE(PerimeterKernel::circles(empty, out).empty());
+    REQUIRE(PerimeterKernel::rectangles(empty, empty, out).empty());
+    REQUIRE(PerimeterKernel::triangles(empty, empty, empty, out).empty());
+}
+
+TEST_CASE("Kernels reject mismatched columns", "[PerimeterKernel]")
+{
+    const std::vector<double> three = {1, 2, 3};
+    const std::vector<double> two = {1, 2};
+    std::vector<double> out(3);
+
+    SECTION("Columns of different length")
+    {
+        REQUIRE_THROWS_WITH(PerimeterKernel::rectangles(three, two, out), "Figure columns must have the same length");
+        REQUIRE_THROWS_WITH(PerimeterKernel::triangles(three, three, two, out),
+                            "Figure columns must have the same length");
+    }
+
+    SECTION("Output too small")
+    {
+        std::vector<double> small(2);
+        REQUIRE_THROWS_WITH(PerimeterKernel::circles(three, small),
+                            "Output buffer is too small for the figure columns");
+    }
+}
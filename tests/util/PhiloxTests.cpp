@@ -0,0 +1,22 @@
+#include <catch2/catch_test_macros.hpp>
+
+#include "../../src/util/philox/Philox.hpp"
+
+TEST_CASE("Philox matches the Random123 known answers", "[Philox]")
+{
+    REQUIRE(Philox::generate({0, 0, 0, 0}, {0, 0}) ==
+            Philox::Counter{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8});
+
+    REQUIRE(Philox::generate({0xffffffff, 0xffffffff, 0xffffffff, 0xffffffff}, {0xffffffff, 0xffffffff}) ==
+            Philox::Counter{0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd});
+
+    REQUIRE(Philox::generate({0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344}, {0xa4093822, 0x299f31d0}) ==
+            Philox::Counter{0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1});
+}
+
+TEST_CASE("Philox unit doubles stay in [0, 1)", "[Philox]")
+{
+    REQUIRE(Philox::toUnitDouble(0) == 0.0);
+    REQUIRE(Philox::toUnitDouble(~0ull) < 1.0);
+    REQUIRE(Philox::toUnitDouble(1ull << 63) == 0.5);
+}
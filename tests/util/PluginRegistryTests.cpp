@@ -0,0 +1,90 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+#include <array>
+#include <cmath>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "../../src/util/plugin_registry/PluginRegistry.hpp"
+
+constexpr double PLUGIN_TOLERANCE = 1e-12;
+
+PluginRegistry loadShapes()
+{
+    PluginRegistry registry;
+    registry.loadDirectory(FIGURES_PLUGIN_DIR);
+    return registry;
+}
+
+TEST_CASE("Plugin directory registers its figure types", "[PluginRegistry]")
+{
+    const PluginRegistry registry = loadShapes();
+
+    REQUIRE(registry.size() == 3);
+
+    const std::optional<PluginRegistry::TypeId> polygon = registry.find("Polygon");
+    REQUIRE(polygon.has_value());
+    REQUIRE(registry.name(*polygon) == "polygon");
+    REQUIRE(registry.params(*polygon) == 2);
+    REQUIRE(registry.params(*registry.find("TRAPEZOID")) == 4);
+
+    REQUIRE_FALSE(registry.find("circle").has_value());
+    REQUIRE_FALSE(registry.find("polygons").has_value());
+}
+
+TEST_CASE("Plugin figures are validated, measured and formatted", "[PluginRegistry]")
+{
+    const PluginRegistry registry = loadShapes();
+    const PluginRegistry::TypeId polygon = *registry.find("polygon");
+    const PluginRegistry::TypeId ellipse = *registry.find("ellipse");
+    const PluginRegistry::TypeId trapezoid = *registry.find("trapezoid");
+
+    REQUIRE(registry.isValid(polygon, std::array{6.0, 2.0}));
+    REQUIRE_FALSE(registry.isValid(polygon, std::array{2.5, 2.0}));
+    REQUIRE_FALSE(registry.isValid(polygon, std::array{6.0}));
+    REQUIRE(registry.isValid(trapezoid, std::array{10.0, 4.0, 5.0, 5.0}));
+    REQUIRE_FALSE(registry.isValid(trapezoid, std::array{10.0, 4.0, 1.0, 1.0}));
+
+    REQUIRE(registry.perimeter(polygon, std::array{6.0, 2.0}) == 12);
+    REQUIRE_THAT(registry.perimeter(ellipse, std::array{1.0, 1.0}),
+                 Catch::Matchers::WithinRel(2 * M_PI, PLUGIN_TOLERANCE));
+    REQUIRE_THROWS_WITH(registry.perimeter(ellipse, std::array{1.0}), "Figure type 'ellipse' requires 2 parameters");
+
+    std::string out;
+    registry.formatTo(trapezoid, std::array{10.0, 4.0, 5.0, 5.5}, out);
+    REQUIRE(out == "Trapezoid 10 4 5 5.5");
+}
+
+TEST_CASE("Plugin batch kernel measures a column of figures", "[PluginRegistry]")
+{
+    const PluginRegistry registry = loadShapes();
+    const PluginRegistry::TypeId ellipse = *registry.find("ellipse");
+
+    const std::vector<double> a = {1, 2, 3, 4};
+    const std::vector<double> b = {1, 1, 2, 8};
+    const std::array<std::span<const double>, 2> columns = {a, b};
+    std::array<double, 4> out{};
+
+    registry.perimeters(ellipse, columns, out);
+
+    for (std::size_t i = 0; i < out.size(); i++)
+    {
+        REQUIRE(out[i] == registry.perimeter(ellipse, std::array{a[i], b[i]}));
+    }
+}
+
+TEST_CASE("Plugin loading reports errors without registering anything", "[PluginRegistry]")
+{
+    PluginRegistry registry = loadShapes();
+
+    REQUIRE_THROWS_WITH(registry.loadDirectory(FIGURES_PLUGIN_DIR), "Figure type already registered: 'polygon'");
+    REQUIRE(registry.size() == 3);
+
+    REQUIRE_THROWS_AS(registry.load("plugin_test_missing.so"), std::runtime_error);
+    REQUIRE_THROWS_WITH(registry.loadDirectory("plugin_test_missing"),
+                        "Cannot open plugin directory: 'plugin_test_missing'");
+    REQUIRE_THROWS_AS(registry.name(3), std::out_of_range);
+}
@@ -0,0 +1,89 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../../src/util/stream_tokenizer/StreamTokenizer.hpp"
+
+std::vector<std::string> readAll(StreamTokenizer &tokenizer)
+{
+    std::vector<std::string> tokens;
+    for (std::string_view token = tokenizer.next(); !token.empty(); token = tokenizer.next())
+    {
+        tokens.emplace_back(token);
+    }
+    return tokens;
+}
+
+TEST_CASE("Tokenizer splits input on whitespace", "[StreamTokenizer]")
+{
+    const bool readAhead = GENERATE(true, false);
+    CAPTURE(readAhead);
+
+    std::istringstream input("  circle 5\n\trectangle   10 20\r\ntriangle 3 4 5  ");
+    StreamTokenizer tokenizer(input, readAhead);
+
+    const std::vector<std::string> expected = {"circle", "5", "rectangle", "10", "20", "triangle", "3", "4", "5"};
+    REQUIRE(readAll(tokenizer) == expected);
+    REQUIRE(tokenizer.next().empty());
+    REQUIRE(tokenizer.getBytesRead() == input.str().size());
+}
+
+TEST_CASE("Tokenizer handles tokens spanning buffer refills", "[StreamTokenizer]")
+{
+    const std::size_t bufferSize = GENERATE(1, 2, 3, 7, 64);
+    CAPTURE(bufferSize);
+
+    std::istringstream input("rectangle 12345.6789 0.000001\ncircle 1e10");
+    StreamTokenizer tokenizer(input, true, bufferSize);
+
+    const std::vector<std::string> expected = {"rectangle", "12345.6789", "0.000001", "circle", "1e10"};
+    REQUIRE(readAll(tokenizer) == expected);
+}
+
+TEST_CASE("Tokenizer returns nothing for empty or blank input", "[StreamTokenizer]")
+{
+    const std::string text = GENERATE("", "   ", "\n\t \n");
+
+    std::istringstream input(text);
+    StreamTokenizer tokenizer(input, true);
+
+    REQUIRE(tokenizer.next().empty());
+}
+
+TEST_CASE("Tokenizer without read-ahead leaves the rest of the stream untouched", "[StreamTokenizer]")
+{
+    std::istringstream input("circle 5\n3\n");
+    StreamTokenizer tokenizer(input, false);
+
+    REQUIRE(tokenizer.next() == "circle");
+    REQUIRE(tokenizer.next() == "5");
+
+    std::string rest;
+    std::getline(input, rest);
+    REQUIRE(rest.empty());
+    std::getline(input, rest);
+    REQUIRE(rest == "3");
+}
+
+TEST_CASE("Tokenizer rejects an empty buffer", "[StreamTokenizer]")
+{
+    std::istringstream input("circle 5");
+
+    REQUIRE_THROWS_WITH(StreamTokenizer(input, true, 0), "Tokenizer buffer size must be positive");
+}
+
+TEST_CASE("Tokenizer returns an unread token again", "[StreamTokenizer]")
+{
+    std::istringstream input("circle 5 rectangle");
+    StreamTokenizer tokenizer(input, GENERATE(true, false), 4);
+
+    REQUIRE(tokenizer.next() == "circle");
+    REQUIRE(tokenizer.next() == "5");
+    tokenizer.unread();
+    REQUIRE(tokenizer.next() == "5");
+    REQUIRE(tokenizer.next() == "rectangle");
+    REQUIRE(tokenizer.next().empty());
+}
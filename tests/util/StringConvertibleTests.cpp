@@ -2,6 +2,10 @@
 #include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 
+#include <sstream>
+#include <string>
+#include <string_view>
+
 #include "../../src/figure/triangle/Triangle.hpp"
 #include "../../src/figure/circle/Circle.hpp"
 #include "../../src/figure/rectangle/Rectangle.hpp"
@@ -77,4 +81,28 @@ TEST_CASE("toString produces correct format for various radii", "[StringConverti
     const std::string result = circle.toString();
 
     REQUIRE(result == expected);
-}
\ No newline at end of file
+}
+TEST_CASE("formatTo appends the shortest text that reads back exactly", "[StringConvertible]")
+{
+    std::string out = "> ";
+    Triangle(0.1, 1.0 / 3, 0.4).formatTo(out);
+    out += '|';
+    Circle(7.690230000000001e+306).formatTo(out);
+
+    REQUIRE(out == "> Triangle 0.1 0.3333333333333333 0.4|Circle 7.690230000000001e+306");
+}
+
+TEST_CASE("formatTo writes into a caller buffer", "[StringConvertible]")
+{
+    char buffer[Figure::MAX_FORMATTED_SIZE];
+    const Triangle widest(1.2345678901234567e+300, 1.2345678901234568e+300, 2.2345678901234567e+300);
+
+    const char *end = widest.formatTo(buffer);
+
+    REQUIRE(end - buffer <= static_cast<std::ptrdiff_t>(Figure::MAX_FORMATTED_SIZE));
+    REQUIRE(std::string_view(buffer, end) == widest.toString());
+
+    std::ostringstream stream;
+    stream << Rectangle(1.5, 2);
+    REQUIRE(stream.str() == "Rectangle 1.5 2\n");
+}
@@ -1,10 +1,12 @@
 #include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
 #include <catch2/matchers/catch_matchers.hpp>
 #include <catch2/matchers/catch_matchers_string.hpp>
 
 #include "../../src/figure/circle/Circle.hpp"
 #include "../../src/figure/rectangle/Rectangle.hpp"
 #include "../../src/figure/triangle/Triangle.hpp"
+#include "../../src/store/figure_arena/FigureArena.hpp"
 #include "../../src/util/string_to_figure/StringToFigure.hpp"
 
 TEST_CASE("createFigure creates valid Triangle", "[StringToFigure]")
@@ -255,3 +257,106 @@ TEST_CASE("createFigure handles decimal values", "[StringToFigure]")
         REQUIRE(dynamic_cast<Rectangle *>(figure.get()) != nullptr);
     }
 }
+
+
+TEST_CASE("createFigure accepts the number formats std::stod accepted", "[StringToFigure]")
+{
+    SECTION("Explicit plus sign")
+    {
+        REQUIRE(StringToFigure::createFigure("circle +5")->toString() == "Circle 5");
+    }
+
+    SECTION("Hexadecimal value")
+    {
+        REQUIRE(StringToFigure::createFigure("rectangle 0x10 0X1p1")->toString() == "Rectangle 16 2");
+    }
+
+    SECTION("Trailing characters after a number are ignored")
+    {
+        REQUIRE(StringToFigure::createFigure("circle 5abc")->toString() == "Circle 5");
+    }
+
+    SECTION("Double sign is rejected")
+    {
+        REQUIRE_THROWS_WITH(StringToFigure::createFigure("circle +-5"), "'+-5' is not a valid number");
+    }
+
+    SECTION("Subnormal value is out of range")
+    {
+        REQUIRE_THROWS_WITH(StringToFigure::createFigure("circle 1e-310"), "'1e-310' can't be stored in a double");
+    }
+}
+
+TEST_CASE("createFigure validates every number before the figure name", "[StringToFigure]")
+{
+    REQUIRE_THROWS_WITH(StringToFigure::createFigure("square abc"), "'abc' is not a valid number");
+    REQUIRE_THROWS_WITH(StringToFigure::createFigure("circle 5 6 7 8 x"), "'x' is not a valid number");
+}
+
+TEST_CASE("parseFigureType matches names case-insensitively", "[StringToFigure]")
+{
+    REQUIRE(StringToFigure::parseFigureType("TrIaNgLe") == FigureUtil::TRIANGLE);
+    REQUIRE(StringToFigure::parseFigureType("CIRCLE") == FigureUtil::CIRCLE);
+    REQUIRE(StringToFigure::parseFigureType("rectangle") == FigureUtil::RECTANGLE);
+    REQUIRE_FALSE(StringToFigure::parseFigureType("circles").has_value());
+    REQUIRE_FALSE(StringToFigure::parseFigureType("").has_value());
+}
+
+TEST_CASE("nextToken splits on whitespace in place", "[StringToFigure]")
+{
+    std::string_view input = "  circle\t5 \n";
+
+    REQUIRE(StringToFigure::nextToken(input) == "circle");
+    REQUIRE(StringToFigure::nextToken(input) == "5");
+    REQUIRE(StringToFigure::nextToken(input).empty());
+    REQUIRE(StringToFigure::nextToken(input).empty());
+}
+
+TEST_CASE("tryCreateFigure returns the figure or an error code", "[StringToFigure]")
+{
+    SECTION("Valid figure")
+    {
+        const std::expected<std::unique_ptr<Figure>, ParseError::Code> figure =
+            StringToFigure::tryCreateFigure("rectangle 10 20");
+
+        REQUIRE(figure.has_value());
+        REQUIRE((*figure)->toString() == "Rectangle 10 20");
+    }
+
+    SECTION("Invalid input")
+    {
+        using Case = std::pair<std::string, ParseError::Code>;
+        const Case invalid = GENERATE(values<Case>({
+            {"pentagon 5", ParseError::UNKNOWN_FIGURE},
+            {"circle 5 6", ParseError::WRONG_PARAMETER_COUNT},
+            {"triangle 1 2 3 4", ParseError::WRONG_PARAMETER_COUNT},
+            {"rectangle 1 2 3 4 5 6", ParseError::WRONG_PARAMETER_COUNT},
+            {"circle abc", ParseError::INVALID_NUMBER},
+            {"circle 1e400", ParseError::NUMBER_OUT_OF_RANGE},
+            {"circle -5", ParseError::INVALID_RADIUS},
+            {"triangle 1 2 10", ParseError::INVALID_TRIANGLE},
+        }));
+
+        CAPTURE(invalid.first);
+
+        const std::expected<std::unique_ptr<Figure>, ParseError::Code> figure =
+            StringToFigure::tryCreateFigure(invalid.first);
+
+        REQUIRE_FALSE(figure.has_value());
+        REQUIRE(figure.error() == invalid.second);
+    }
+}
+
+TEST_CASE("createFigure allocates from an arena", "[StringToFigure]")
+{
+    FigureArena arena;
+
+    const Figure *rectangle = StringToFigure::createFigure("Rectangle 10 20", arena);
+    const Figure *circle = StringToFigure::createFigure(FigureUtil::CIRCLE, std::array{2.5}, arena);
+
+    REQUIRE(rectangle->toString() == "Rectangle 10 20");
+    REQUIRE(circle->toString() == "Circle 2.5");
+    REQUIRE(StringToFigure::createFigure("pentagon 5", arena) == nullptr);
+    REQUIRE_THROWS_WITH(StringToFigure::createFigure("circle 5 6", arena), "Circle requires one parameter");
+    REQUIRE(arena.size() == 2);
+}